@@ -1,10 +1,20 @@
 #pragma once
 
 #include <SDL_wrapper/Core/Clock.hpp>
+#include <SDL_wrapper/Core/EventBus.hpp>
 #include <SDL_wrapper/Core/EventRegistrator.hpp>
 #include <SDL_wrapper/Core/FileWorker.hpp>
+#include <SDL_wrapper/Core/FrameArena.hpp>
+#include <SDL_wrapper/Core/FrameLimiter.hpp>
+#include <SDL_wrapper/Core/InputState.hpp>
+#include <SDL_wrapper/Core/MotionCoalescer.hpp>
 #include <SDL_wrapper/Core/Names.hpp>
 #include <SDL_wrapper/Core/Rect.hpp>
+#include <SDL_wrapper/Core/SmallVector.hpp>
+#include <SDL_wrapper/Core/ThreadPool.hpp>
+#include <SDL_wrapper/Core/TripleBuffer.hpp>
 #include <SDL_wrapper/Core/Math/Colors.hpp>
+#include <SDL_wrapper/Core/Math/Intersection.hpp>
 #include <SDL_wrapper/Core/Math/Matrix3x3.hpp>
+#include <SDL_wrapper/Core/Math/Triangulation.hpp>
 #include <SDL_wrapper/Core/Math/VectorMath.hpp>
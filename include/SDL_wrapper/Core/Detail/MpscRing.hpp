@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace sdl3::detail
+{
+
+// Ограниченное кольцо "много писателей - один читатель" без блокировок (схема Вьюкова).
+// Память под все ячейки выделяется один раз, запись не обращается к куче.
+// Каждая ячейка хранит номер шага: писатель занимает её CAS-ом по хвосту, читатель
+// видит её готовой, когда номер равен позиции + 1.
+template <typename T>
+class MpscRing
+{
+    static_assert(std::is_nothrow_move_constructible_v<T>, "MpscRing payload must be nothrow move constructible");
+
+public:
+    explicit MpscRing(const std::size_t capacity)
+        : mask_(std::bit_ceil(capacity < 2 ? std::size_t(2) : capacity) - 1),
+          cells_(std::make_unique<Cell[]>(mask_ + 1))
+    {
+        for (std::size_t i = 0; i <= mask_; ++i)
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    MpscRing(const MpscRing &) = delete;
+    MpscRing &operator=(const MpscRing &) = delete;
+
+    ~MpscRing()
+    {
+        while (front())
+            popFront();
+    }
+
+    std::size_t getCapacity() const noexcept
+    {
+        return mask_ + 1;
+    }
+
+    // Любой поток. false - кольцо заполнено
+    bool push(T &&value) noexcept
+    {
+        std::size_t pos = tail_.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Cell &cell = cells_[pos & mask_];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0)
+            {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    std::construct_at(cell.get(), std::move(value));
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+                return false;
+            else
+                pos = tail_.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Только читатель: первый готовый элемент или nullptr
+    T *front() noexcept
+    {
+        Cell &cell = cells_[head_ & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != head_ + 1)
+            return nullptr;
+        return cell.get();
+    }
+
+    void popFront() noexcept
+    {
+        Cell &cell = cells_[head_ & mask_];
+        std::destroy_at(cell.get());
+        cell.sequence.store(head_ + mask_ + 1, std::memory_order_release);
+        ++head_;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence = 0;
+        alignas(T) std::byte storage[sizeof(T)];
+
+        T *get() noexcept
+        {
+            return std::launder(reinterpret_cast<T *>(storage));
+        }
+    };
+
+    // Хвост и голова на разных кэш-линиях, чтобы писатели не мешали читателю
+    static constexpr std::size_t cacheLine = 64;
+
+    const std::size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+
+    alignas(cacheLine) std::atomic<std::size_t> tail_ = 0;
+    alignas(cacheLine) std::size_t head_ = 0;
+};
+
+} // namespace sdl3::detail
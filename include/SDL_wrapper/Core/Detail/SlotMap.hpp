@@ -0,0 +1,197 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace sdl3::detail
+{
+
+// Поколенческий slot map для реестров: чтение по ID без блокировок, вставка и удаление под мьютексом.
+// ID = индекс слота + поколение: после удаления слот получает новое поколение, поэтому старый ID
+// никогда не начинает указывать на чужое значение (ABA). Первый выданный ID всегда 0.
+// Слоты лежат в блоках, которые не перемещаются и не освобождаются до разрушения карты.
+template <typename T>
+class SlotMap
+{
+public:
+    using Id = std::size_t;
+
+    static constexpr Id invalidId = Id(-1);
+
+public:
+    SlotMap() = default;
+
+    SlotMap(const SlotMap &) = delete;
+    SlotMap &operator=(const SlotMap &) = delete;
+
+    ~SlotMap()
+    {
+        for (auto &chunk : chunks_)
+            delete chunk.load(std::memory_order_relaxed);
+    }
+
+    Id insert(T value)
+    {
+        std::lock_guard lk(writeMtx_);
+
+        std::size_t index = 0;
+        if (!freeList_.empty())
+        {
+            index = freeList_.back();
+            freeList_.pop_back();
+        }
+        else
+        {
+            if (slotCount_ == maxSlots)
+                return invalidId;
+            index = slotCount_;
+            auto &chunk = chunks_[index / chunkSize];
+            if (!chunk.load(std::memory_order_relaxed))
+            {
+                // Место в списке свободных под каждый слот блока: erase() кладёт туда индекс без выделения памяти
+                freeList_.reserve(index + chunkSize);
+                chunk.store(new Chunk(), std::memory_order_release);
+            }
+            ++slotCount_;
+        }
+
+        Slot &slot = slotAt(index);
+        // Слот свободен: читатели с любым ID видят несовпадение состояния и значение не трогают
+        slot.value = std::move(value);
+        const std::uint32_t state = slot.state.load(std::memory_order_relaxed) | occupiedBit;
+        slot.state.store(state, std::memory_order_release);
+
+        return makeId(index, state >> 1);
+    }
+
+    bool erase(const Id id) noexcept
+    {
+        std::lock_guard lk(writeMtx_);
+
+        Slot *slot = findSlot(id);
+        if (!slot)
+            return false;
+
+        const std::uint32_t expected = stateFor(id);
+        if (slot->state.load(std::memory_order_relaxed) != expected)
+            return false;
+
+        // Сначала новое поколение, затем ожидание читателей, успевших пройти проверку
+        const std::uint32_t nextGeneration = ((expected >> 1) + 1) & generationMask;
+        slot->state.store(nextGeneration << 1, std::memory_order_seq_cst);
+        while (slot->readers.load(std::memory_order_seq_cst) != 0)
+            std::this_thread::yield();
+
+        slot->value = T{};
+        freeList_.push_back(indexOf(id)); // ёмкость зарезервирована в insert()
+        return true;
+    }
+
+    // Копия значения или T{}, если ID устарел. Без блокировок
+    T get(const Id id) const
+    {
+        const Slot *slot = findSlot(id);
+        if (!slot)
+            return T{};
+
+        slot->readers.fetch_add(1, std::memory_order_seq_cst);
+        T result{};
+        if (slot->state.load(std::memory_order_seq_cst) == stateFor(id))
+            result = slot->value;
+        slot->readers.fetch_sub(1, std::memory_order_release);
+        return result;
+    }
+
+    bool contains(const Id id) const noexcept
+    {
+        const Slot *slot = findSlot(id);
+        return slot && slot->state.load(std::memory_order_acquire) == stateFor(id);
+    }
+
+    // ID занятого слота с наименьшим индексом, значение которого подходит под pred; invalidId, если таких нет.
+    // Под мьютексом записи: для редких запросов, не для горячего пути
+    template <typename Pred>
+    Id findFirst(Pred pred)
+    {
+        std::lock_guard lk(writeMtx_);
+
+        for (std::size_t index = 0; index < slotCount_; ++index)
+        {
+            const Slot &slot = slotAt(index);
+            const std::uint32_t state = slot.state.load(std::memory_order_relaxed);
+            if ((state & occupiedBit) && pred(slot.value))
+                return makeId(index, state >> 1);
+        }
+        return invalidId;
+    }
+
+private:
+    // На 32-битных платформах ID делится пополам: 16 бит индекса и 16 бит поколения
+    static constexpr unsigned indexBits = sizeof(Id) * 4;
+    static constexpr Id indexMask = (Id(1) << indexBits) - 1;
+    static constexpr std::uint32_t generationMask = static_cast<std::uint32_t>(indexBits >= 32 ? 0x7fffffffu : indexMask);
+    static constexpr std::uint32_t occupiedBit = 1;
+
+    static constexpr std::size_t chunkSize = 64;
+    static constexpr std::size_t maxChunks = 1024;
+    static constexpr std::size_t maxSlots = chunkSize * maxChunks;
+
+    struct Slot
+    {
+        std::atomic<std::uint32_t> state = 0; // (поколение << 1) | занят
+        mutable std::atomic<std::uint32_t> readers = 0;
+        T value{};
+    };
+
+    struct Chunk
+    {
+        Slot slots[chunkSize];
+    };
+
+    std::array<std::atomic<Chunk *>, maxChunks> chunks_{};
+
+    std::mutex writeMtx_;
+    std::vector<std::size_t> freeList_;
+    std::size_t slotCount_ = 0;
+
+private:
+    static Id makeId(const std::size_t index, const std::uint32_t generation) noexcept
+    {
+        return (static_cast<Id>(generation & generationMask) << indexBits) | static_cast<Id>(index);
+    }
+
+    static std::size_t indexOf(const Id id) noexcept
+    {
+        return static_cast<std::size_t>(id & indexMask);
+    }
+
+    static std::uint32_t stateFor(const Id id) noexcept
+    {
+        const auto generation = static_cast<std::uint32_t>(id >> indexBits) & generationMask;
+        return (generation << 1) | occupiedBit;
+    }
+
+    Slot &slotAt(const std::size_t index) const noexcept
+    {
+        return chunks_[index / chunkSize].load(std::memory_order_relaxed)->slots[index % chunkSize];
+    }
+
+    Slot *findSlot(const Id id) const noexcept
+    {
+        if (id == invalidId)
+            return nullptr;
+        const std::size_t index = indexOf(id);
+        if (index >= maxSlots)
+            return nullptr;
+        Chunk *chunk = chunks_[index / chunkSize].load(std::memory_order_acquire);
+        return chunk ? &chunk->slots[index % chunkSize] : nullptr;
+    }
+};
+
+} // namespace sdl3::detail
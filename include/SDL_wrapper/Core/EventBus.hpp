@@ -0,0 +1,179 @@
+#pragma once
+
+#include <SDL_wrapper/Core/Export.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <SDL_wrapper/Core/Detail/MpscRing.hpp>
+
+namespace sdl3
+{
+
+// Типизированная шина событий: у каждого типа события своё кольцо фиксированной ёмкости
+// (много писателей - один читатель), поэтому рабочие потоки публикуют результаты без
+// блокировок, без кучи и мимо очереди SDL. Обработчики вызываются пачкой в dispatch().
+// post() - из любого потока; subscribe/unsubscribe/dispatch - из одного (главного) потока.
+class SDL_WRAPPER_CORE_EXPORT EventBus
+{
+public:
+    using SubscriptionId = std::uint64_t;
+
+    static constexpr std::size_t maxEventTypes = 64;
+    static constexpr SubscriptionId invalidSubscription = 0;
+
+public:
+    // defaultCapacity - ёмкость кольца для типов без явного reserve()
+    explicit EventBus(std::size_t defaultCapacity = 1024);
+    ~EventBus();
+
+    EventBus(const EventBus &) = delete;
+    EventBus &operator=(const EventBus &) = delete;
+
+    // Задаёт ёмкость кольца типа T. Действует, только если канал ещё не создан
+    template <typename T>
+    bool reserve(const std::size_t capacity)
+    {
+        return acquireChannel<T>(capacity) != nullptr;
+    }
+
+    // false - кольцо заполнено (событие отброшено) или превышено число типов
+    template <typename T>
+    bool post(T event)
+    {
+        Channel<T> *channel = acquireChannel<T>(defaultCapacity_);
+        return channel && channel->ring.push(std::move(event));
+    }
+
+    template <typename T>
+    SubscriptionId subscribe(std::function<void(const T &)> handler)
+    {
+        Channel<T> *channel = acquireChannel<T>(defaultCapacity_);
+        if (!channel || !handler)
+            return invalidSubscription;
+
+        const SubscriptionId id = nextSubscription_++;
+        // Во время dispatch() новые обработчики откладываются, чтобы не перекладывать вектор под вызовом
+        (dispatching_ ? channel->pending : channel->handlers).push_back({id, std::move(handler)});
+        return id;
+    }
+
+    bool unsubscribe(SubscriptionId id);
+
+    // Раздаёт накопленные события. За вызов из канала берётся не больше его ёмкости,
+    // поэтому обработчик, публикующий тот же тип, не зацикливает dispatch(). Возвращает число событий.
+    // Вызов из обработчика ничего не делает и возвращает 0
+    std::size_t dispatch();
+
+private:
+    struct ChannelBase
+    {
+        virtual ~ChannelBase() = default;
+
+        virtual std::size_t drain() = 0;
+        virtual bool unsubscribe(SubscriptionId id) = 0;
+        virtual void flushPending() = 0;
+    };
+
+    template <typename T>
+    struct Channel final : ChannelBase
+    {
+        struct Handler
+        {
+            SubscriptionId id = invalidSubscription;
+            std::function<void(const T &)> fn;
+        };
+
+        detail::MpscRing<T> ring;
+        std::vector<Handler> handlers;
+        std::vector<Handler> pending;
+
+        explicit Channel(const std::size_t capacity)
+            : ring(capacity)
+        {
+        }
+
+        std::size_t drain() override
+        {
+            std::size_t count = 0;
+            const std::size_t limit = ring.getCapacity();
+            while (count < limit)
+            {
+                T *event = ring.front();
+                if (!event)
+                    break;
+                for (const Handler &handler : handlers)
+                    if (handler.fn)
+                        handler.fn(*event);
+                ring.popFront();
+                ++count;
+            }
+            return count;
+        }
+
+        bool unsubscribe(const SubscriptionId id) override
+        {
+            for (auto *list : {&handlers, &pending})
+                for (Handler &handler : *list)
+                    if (handler.id == id && handler.fn)
+                    {
+                        // Только обнуляем: вектор может обходиться прямо сейчас
+                        handler.fn = nullptr;
+                        return true;
+                    }
+            return false;
+        }
+
+        void flushPending() override
+        {
+            std::erase_if(handlers, [](const Handler &handler) { return !handler.fn; });
+            for (Handler &handler : pending)
+                if (handler.fn)
+                    handlers.push_back(std::move(handler));
+            pending.clear();
+        }
+    };
+
+    std::array<std::atomic<ChannelBase *>, maxEventTypes> channels_{};
+    std::size_t defaultCapacity_;
+    SubscriptionId nextSubscription_ = 1;
+    bool dispatching_ = false;
+
+private:
+    static std::size_t nextTypeIndex();
+
+    template <typename T>
+    static std::size_t typeIndex()
+    {
+        static const std::size_t index = nextTypeIndex();
+        return index;
+    }
+
+    // Канал создаётся лениво любым потоком; проигравший гонку CAS удаляет свою копию
+    template <typename T>
+    Channel<T> *acquireChannel(const std::size_t capacity)
+    {
+        const std::size_t index = typeIndex<T>();
+        if (index >= maxEventTypes)
+            return nullptr;
+
+        std::atomic<ChannelBase *> &slot = channels_[index];
+        ChannelBase *channel = slot.load(std::memory_order_acquire);
+        if (!channel)
+        {
+            auto created = std::make_unique<Channel<T>>(capacity);
+            if (slot.compare_exchange_strong(channel, created.get(), std::memory_order_acq_rel, std::memory_order_acquire))
+                channel = created.release();
+        }
+        return static_cast<Channel<T> *>(channel);
+    }
+};
+
+} // namespace sdl3
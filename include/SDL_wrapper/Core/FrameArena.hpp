@@ -0,0 +1,59 @@
+#pragma once
+
+#include <SDL_wrapper/Core/Export.hpp>
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+namespace sdl3
+{
+
+// Линейный (bump) аллокатор для данных, живущих не дольше кадра. Освобождение - no-op,
+// память возвращается целиком через reset(). После reset() блоки сливаются в один размером
+// с пиковым расходом, поэтому в установившемся режиме кадр не обращается к куче.
+// Наследуется от std::pmr::memory_resource и подходит для std::pmr-контейнеров.
+class SDL_WRAPPER_CORE_EXPORT FrameArena : public std::pmr::memory_resource
+{
+public:
+    explicit FrameArena(std::size_t initialCapacity = 64 * 1024);
+    ~FrameArena() override;
+
+    FrameArena(const FrameArena &) = delete;
+    FrameArena &operator=(const FrameArena &) = delete;
+
+    template <class T>
+    T *allocateArray(const std::size_t count)
+    {
+        return static_cast<T *>(allocate(count * sizeof(T), alignof(T)));
+    }
+
+    // Все выделенные с прошлого reset() указатели становятся недействительными
+    void reset();
+
+    std::size_t getUsedBytes() const;
+    std::size_t getCapacity() const;
+
+private:
+    struct Block
+    {
+        std::byte *data = nullptr;
+        std::size_t size = 0;
+    };
+
+    std::vector<Block> blocks_;
+    std::size_t current_ = 0;
+    std::size_t offset_ = 0;
+    std::size_t usedBefore_ = 0; // заполнено в блоках до текущего
+
+private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+    static Block allocateBlock(std::size_t size);
+    static void freeBlock(const Block &block) noexcept;
+};
+
+} // namespace sdl3
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <SDL_wrapper/Core/Export.hpp>
+
+#include <cstdint>
+
+#include <SDL_wrapper/Core/Clock.hpp>
+
+namespace sdl3
+{
+
+// Статистика длительности кадров с последнего resetStats(), в наносекундах
+struct FrameStats
+{
+    std::uint64_t frames = 0;
+    std::uint64_t lastNS = 0;
+    std::uint64_t minNS = 0;
+    std::uint64_t maxNS = 0;
+    double averageNS = 0.0;
+    // Кадры, не уложившиеся в целевое время (только при заданном ограничении)
+    std::uint64_t missed = 0;
+};
+
+// Ограничитель частоты кадров на ClockNS. Сначала спит, пока до срока больше порога, затем
+// докручивает остаток в цикле - точность около 0.1 мс без полной загрузки ядра. Порог подстраивается
+// под фактическое пересыпание системного сна. Сроки идут с шагом периода, поэтому ошибка
+// отдельного кадра не накапливается; после сильного отставания отсчёт начинается заново.
+class SDL_WRAPPER_CORE_EXPORT FrameLimiter
+{
+public:
+    // 0 - без ограничения, только статистика
+    explicit FrameLimiter(double framerate = 0.0);
+
+    void setFramerateLimit(double framerate);
+    double getFramerateLimit() const;
+
+    // Вызывается раз в кадр после показа: ждёт срока кадра и возвращает его длительность
+    std::uint64_t wait();
+    // Новый отсчёт сроков, например после паузы или загрузки
+    void reset();
+
+    const FrameStats &getStats() const;
+    void resetStats();
+
+private:
+    ClockNS clock_;
+    std::uint64_t periodNS_ = 0;
+    std::uint64_t deadlineNS_ = 0;
+    std::uint64_t frameStartNS_ = 0;
+
+    // Сколько до срока оставлять на докрутку; оценка пересыпания системного сна
+    std::uint64_t spinThresholdNS_ = 1'000'000;
+
+    FrameStats stats_;
+    double totalNS_ = 0.0;
+
+private:
+    void sleepUntil(std::uint64_t deadlineNS);
+    void recordFrame(std::uint64_t frameNS);
+};
+
+} // namespace sdl3
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <SDL_wrapper/Core/Export.hpp>
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <SDL3/SDL_events.h>
+
+#include <SDL_wrapper/Core/Names.hpp>
+
+namespace sdl3
+{
+
+struct TouchPoint
+{
+    std::uint64_t touchID = 0;
+    std::uint64_t fingerID = 0;
+    Vector2f position;
+    float pressure = 0.f;
+};
+
+// Снимок ввода за кадр: состояние клавиш и кнопок, позиция указателя, касания и фронты
+// (нажато/отпущено в этом кадре). Заполняется из событий один раз за кадр, после чего
+// запросы - чтение битов без обращения к SDL. Тривиально копируется, что удобно для TripleBuffer.
+// Координаты такие же, как в поданных событиях (после RenderWindow::pollEvents - координаты вида).
+class SDL_WRAPPER_CORE_EXPORT InputState
+{
+public:
+    static constexpr std::size_t maxTouches = 10;
+
+public:
+    // Сбрасывает фронты и накопленные за кадр смещения; удерживаемое состояние сохраняется
+    void beginFrame();
+
+    void processEvent(const SDL_Event &event);
+    void processEvents(std::span<const SDL_Event> events);
+
+    std::uint64_t getFrame() const;
+
+    bool isKeyDown(SDL_Scancode scancode) const;
+    bool wasKeyPressed(SDL_Scancode scancode) const;
+    bool wasKeyReleased(SDL_Scancode scancode) const;
+
+    // button - номер SDL_BUTTON_* (1..32)
+    bool isMouseButtonDown(std::uint8_t button) const;
+    bool wasMouseButtonPressed(std::uint8_t button) const;
+    bool wasMouseButtonReleased(std::uint8_t button) const;
+
+    const Vector2f &getMousePosition() const;
+    const Vector2f &getMouseDelta() const;
+    const Vector2f &getWheelDelta() const;
+
+    std::span<const TouchPoint> getTouches() const;
+
+private:
+    using KeyBits = std::bitset<SDL_SCANCODE_COUNT>;
+
+    KeyBits keysDown_;
+    KeyBits keysPressed_;
+    KeyBits keysReleased_;
+
+    std::uint32_t buttonsDown_ = 0;
+    std::uint32_t buttonsPressed_ = 0;
+    std::uint32_t buttonsReleased_ = 0;
+
+    Vector2f mousePosition_;
+    Vector2f mouseDelta_;
+    Vector2f wheelDelta_;
+
+    std::array<TouchPoint, maxTouches> touches_{};
+    std::size_t touchCount_ = 0;
+
+    std::uint64_t frame_ = 0;
+
+private:
+    static std::uint32_t buttonBit(std::uint8_t button);
+
+    TouchPoint *findTouch(std::uint64_t touchID, std::uint64_t fingerID);
+    void setKey(SDL_Scancode scancode, bool down, bool repeat);
+    void setButton(std::uint8_t button, bool down);
+};
+
+} // namespace sdl3
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <SDL_wrapper/Core/Export.hpp>
+
+#include <span>
+
+#include <SDL_wrapper/Core/Names.hpp>
+
+namespace sdl3
+{
+
+// Теорема о разделяющей оси для двух выпуклых многоугольников (обход в любую сторону).
+// Касание считается пересечением; многоугольники меньше чем из трёх точек не пересекаются ни с чем.
+SDL_WRAPPER_CORE_EXPORT bool intersectConvexPolygons(std::span<const Vector2f> a, std::span<const Vector2f> b);
+
+} // namespace sdl3
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstddef>
+
 #include <SDL_wrapper/Core/Names.hpp>
+#include <SDL_wrapper/Core/Rect.hpp>
 
 namespace sdl3
 {
@@ -27,6 +30,20 @@ struct Matrix3x3
             b * p.x + d * p.y + ty};
     }
 
+    // Пакетное преобразование точек. Коэффициенты вынесены в локальные переменные, цикл без ветвлений -
+    // компилятор векторизует его; in и out могут совпадать
+    void transformPoints(const Vector2<T> *in, Vector2<T> *out, const std::size_t count) const
+    {
+        const T ma = a, mb = b, mc = c, md = d, mx = tx, my = ty;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const T x = in[i].x;
+            const T y = in[i].y;
+            out[i].x = ma * x + mc * y + mx;
+            out[i].y = mb * x + md * y + my;
+        }
+    }
+
     Vector2<T> transformVector(const Vector2<T> &v) const
     {
         return {
@@ -41,6 +58,27 @@ struct Matrix3x3
             0.0f * p.x + 0.0f * p.y + 1.0f * p.z};
     }
 
+    // Осевая рамка вокруг преобразованного прямоугольника
+    Rect<T> transformRect(const Rect<T> &r) const
+    {
+        const Vector2<T> corners[4] = {
+            transform({r.x, r.y}),
+            transform({r.x + r.w, r.y}),
+            transform({r.x + r.w, r.y + r.h}),
+            transform({r.x, r.y + r.h})};
+
+        T minX = corners[0].x, maxX = corners[0].x;
+        T minY = corners[0].y, maxY = corners[0].y;
+        for (const auto &p : corners)
+        {
+            minX = p.x < minX ? p.x : minX;
+            maxX = p.x > maxX ? p.x : maxX;
+            minY = p.y < minY ? p.y : minY;
+            maxY = p.y > maxY ? p.y : maxY;
+        }
+        return {minX, minY, maxX - minX, maxY - minY};
+    }
+
     Matrix3x3 operator*(const Matrix3x3 &other) const
     {
         Matrix3x3 result;
@@ -53,9 +91,15 @@ struct Matrix3x3
         return result;
     }
 
+    // Коэффициент изменения площади; отрицателен при отражении
+    T determinant() const
+    {
+        return a * d - b * c;
+    }
+
     bool tryInverse(Matrix3x3 &out) const
     {
-        const T det = a * d - b * c;
+        const T det = determinant();
         if (det == static_cast<T>(0))
             return false;
 
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <SDL_wrapper/Core/Export.hpp>
+
+#include <span>
+#include <vector>
+
+#include <SDL_wrapper/Core/Names.hpp>
+
+namespace sdl3
+{
+
+// Триангуляция простого (в т.ч. невыпуклого) многоугольника с отверстиями. Большие входы
+// разбиваются на монотонные части за O(n log n), малые и вырожденные - отсечением ушей.
+// Возвращает тройки индексов; вершины отверстий нумеруются после внешнего контура, по порядку.
+SDL_WRAPPER_CORE_EXPORT std::vector<int> triangulatePolygon(std::span<const Vector2f> outer,
+                                                            std::span<const std::vector<Vector2f>> holes = {});
+
+SDL_WRAPPER_CORE_EXPORT bool isConvexPolygon(std::span<const Vector2f> polygon);
+
+} // namespace sdl3
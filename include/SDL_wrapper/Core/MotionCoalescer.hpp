@@ -0,0 +1,86 @@
+#pragma once
+
+#include <SDL_wrapper/Core/Export.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <SDL3/SDL_events.h>
+
+#include <SDL_wrapper/Core/Names.hpp>
+#include <SDL_wrapper/Core/SmallVector.hpp>
+
+namespace sdl3
+{
+
+struct MotionSample
+{
+    Vector2f position;
+    std::uint64_t timestamp = 0;
+};
+
+// Склеивает подряд идущие события движения (мышь, палец, перо) одного устройства в одно:
+// позиция и состояние берутся из последнего, относительные смещения суммируются.
+// Любое другое событие завершает склейку, поэтому порядок нажатий и движений сохраняется.
+// При включённой записи пути промежуточные точки доступны через getPath().
+class SDL_WRAPPER_CORE_EXPORT MotionCoalescer
+{
+public:
+    void setPathRecording(bool enabled);
+    bool isPathRecording() const;
+
+    // Сжимает события на месте и возвращает укороченный префикс
+    std::span<SDL_Event> coalesce(std::span<SDL_Event> events);
+
+    // Все точки склеенного события по его индексу в результате последнего coalesce().
+    // Пусто, если запись пути выключена или событие не является движением
+    std::span<const MotionSample> getPath(std::size_t eventIndex) const;
+
+private:
+    struct StreamKey
+    {
+        std::uint32_t type = 0;
+        std::uint32_t windowID = 0;
+        std::uint64_t device = 0;
+        std::uint64_t finger = 0;
+
+        bool operator==(const StreamKey &) const = default;
+    };
+
+    struct OpenStream
+    {
+        StreamKey key;
+        std::size_t eventIndex = 0;
+    };
+
+    struct PathEntry
+    {
+        std::size_t eventIndex = 0;
+        MotionSample sample;
+    };
+
+    struct PathRange
+    {
+        std::size_t eventIndex = 0;
+        std::size_t first = 0;
+        std::size_t count = 0;
+    };
+
+    bool recordPath_ = false;
+
+    SmallVector<OpenStream, 8> open_;
+    std::vector<PathEntry> entries_;
+    std::vector<MotionSample> samples_;
+    std::vector<PathRange> ranges_;
+
+private:
+    static bool getStreamKey(const SDL_Event &event, StreamKey &key);
+    static MotionSample getSample(const SDL_Event &event);
+    static void merge(SDL_Event &into, const SDL_Event &next);
+
+    void buildPaths();
+};
+
+} // namespace sdl3
@@ -0,0 +1,306 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace sdl3
+{
+
+// Вектор со встроенным буфером на N элементов: пока размер не превышает N, память
+// лежит внутри объекта, при переполнении элементы переносятся в кучу.
+template <typename T, std::size_t N>
+class SmallVector
+{
+    static_assert(N > 0, "SmallVector needs a non-zero inline capacity");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using iterator = T *;
+    using const_iterator = const T *;
+
+public:
+    SmallVector() = default;
+
+    explicit SmallVector(const size_type count)
+    {
+        resize(count);
+    }
+
+    SmallVector(const size_type count, const T &value)
+    {
+        resize(count, value);
+    }
+
+    SmallVector(std::initializer_list<T> list)
+    {
+        assign(list.begin(), list.end());
+    }
+
+    template <typename It>
+        requires std::input_iterator<It>
+    SmallVector(It first, It last)
+    {
+        assign(first, last);
+    }
+
+    SmallVector(const SmallVector &other)
+    {
+        assign(other.begin(), other.end());
+    }
+
+    SmallVector(SmallVector &&other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        moveFrom(other);
+    }
+
+    ~SmallVector()
+    {
+        clear();
+        releaseHeap();
+    }
+
+    SmallVector &operator=(const SmallVector &other)
+    {
+        if (this != &other)
+            assign(other.begin(), other.end());
+        return *this;
+    }
+
+    SmallVector &operator=(SmallVector &&other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            clear();
+            releaseHeap();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    template <typename It>
+        requires std::input_iterator<It>
+    void assign(It first, It last)
+    {
+        clear();
+        if constexpr (std::forward_iterator<It>)
+            reserve(static_cast<size_type>(std::distance(first, last)));
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+
+    iterator begin() noexcept
+    {
+        return data_;
+    }
+    const_iterator begin() const noexcept
+    {
+        return data_;
+    }
+    iterator end() noexcept
+    {
+        return data_ + size_;
+    }
+    const_iterator end() const noexcept
+    {
+        return data_ + size_;
+    }
+
+    pointer data() noexcept
+    {
+        return data_;
+    }
+    const_pointer data() const noexcept
+    {
+        return data_;
+    }
+
+    size_type size() const noexcept
+    {
+        return size_;
+    }
+    size_type capacity() const noexcept
+    {
+        return capacity_;
+    }
+    bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+    // true, пока элементы лежат во встроенном буфере
+    bool isInline() const noexcept
+    {
+        return data_ == inlineData();
+    }
+
+    reference operator[](const size_type index)
+    {
+        return data_[index];
+    }
+    const_reference operator[](const size_type index) const
+    {
+        return data_[index];
+    }
+
+    reference front()
+    {
+        return data_[0];
+    }
+    const_reference front() const
+    {
+        return data_[0];
+    }
+    reference back()
+    {
+        return data_[size_ - 1];
+    }
+    const_reference back() const
+    {
+        return data_[size_ - 1];
+    }
+
+    void reserve(const size_type capacity)
+    {
+        if (capacity > capacity_)
+            reallocate(capacity);
+    }
+
+    void push_back(const T &value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T &&value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args &&...args)
+    {
+        if (size_ == capacity_)
+        {
+            // Аргумент может ссылаться на элемент самого вектора: строим копию до переноса
+            T value(std::forward<Args>(args)...);
+            reallocate(capacity_ * 2);
+            std::construct_at(data_ + size_, std::move(value));
+        }
+        else
+            std::construct_at(data_ + size_, std::forward<Args>(args)...);
+        return data_[size_++];
+    }
+
+    void pop_back()
+    {
+        std::destroy_at(data_ + --size_);
+    }
+
+    void resize(const size_type count)
+    {
+        if (count < size_)
+        {
+            std::destroy(data_ + count, data_ + size_);
+            size_ = count;
+            return;
+        }
+        reserve(count);
+        std::uninitialized_value_construct(data_ + size_, data_ + count);
+        size_ = count;
+    }
+
+    void resize(const size_type count, const T &value)
+    {
+        if (count < size_)
+        {
+            std::destroy(data_ + count, data_ + size_);
+            size_ = count;
+            return;
+        }
+        if (count > capacity_)
+        {
+            T copy(value);
+            reallocate(count);
+            std::uninitialized_fill(data_ + size_, data_ + count, copy);
+        }
+        else
+            std::uninitialized_fill(data_ + size_, data_ + count, value);
+        size_ = count;
+    }
+
+    void clear() noexcept
+    {
+        std::destroy(data_, data_ + size_);
+        size_ = 0;
+    }
+
+    friend bool operator==(const SmallVector &left, const SmallVector &right)
+    {
+        return std::equal(left.begin(), left.end(), right.begin(), right.end());
+    }
+
+private:
+    alignas(T) std::byte inline_[sizeof(T) * N];
+
+    T *data_ = inlineData();
+    size_type size_ = 0;
+    size_type capacity_ = N;
+
+private:
+    T *inlineData() noexcept
+    {
+        return std::launder(reinterpret_cast<T *>(inline_));
+    }
+    const T *inlineData() const noexcept
+    {
+        return std::launder(reinterpret_cast<const T *>(inline_));
+    }
+
+    void reallocate(const size_type capacity)
+    {
+        T *storage = static_cast<T *>(::operator new(capacity * sizeof(T), std::align_val_t{alignof(T)}));
+        std::uninitialized_move(data_, data_ + size_, storage);
+        std::destroy(data_, data_ + size_);
+        releaseHeap();
+        data_ = storage;
+        capacity_ = capacity;
+    }
+
+    void releaseHeap() noexcept
+    {
+        if (!isInline())
+            ::operator delete(data_, std::align_val_t{alignof(T)});
+        data_ = inlineData();
+        capacity_ = N;
+    }
+
+    void moveFrom(SmallVector &other)
+    {
+        if (other.isInline())
+        {
+            std::uninitialized_move(other.begin(), other.end(), data_);
+            size_ = other.size_;
+            other.clear();
+            return;
+        }
+        // Куча передаётся целиком, без поэлементного переноса
+        data_ = other.data_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        other.data_ = other.inlineData();
+        other.size_ = 0;
+        other.capacity_ = N;
+    }
+};
+
+} // namespace sdl3
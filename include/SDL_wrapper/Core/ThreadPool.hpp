@@ -0,0 +1,66 @@
+#pragma once
+
+#include <SDL_wrapper/Core/Export.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sdl3
+{
+
+// Пул рабочих потоков для параллельной обработки диапазонов
+class SDL_WRAPPER_CORE_EXPORT ThreadPool
+{
+public:
+    using RangeTask = std::function<void(std::size_t begin, std::size_t end)>;
+
+public:
+    // 0 - по числу аппаратных потоков минус вызывающий
+    explicit ThreadPool(std::size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    std::size_t getThreadCount() const;
+
+    // Делит [0, count) на куски не меньше grain и блокирует до их обработки.
+    // Вызывающий поток тоже берёт куски; первое исключение пробрасывается наружу.
+    void parallelFor(std::size_t count, const RangeTask &task, std::size_t grain = 1);
+
+private:
+    struct Job
+    {
+        const RangeTask *task = nullptr;
+        std::size_t count = 0;
+        std::size_t grain = 1;
+        std::atomic<std::size_t> next = 0;
+        std::exception_ptr error;
+        std::mutex errorMtx;
+    };
+
+    std::vector<std::thread> workers_;
+
+    std::mutex mtx_;
+    std::condition_variable wake_;
+    std::condition_variable finished_;
+    Job *job_ = nullptr;
+    std::uint64_t generation_ = 0;
+    std::size_t active_ = 0;
+    bool stop_ = false;
+
+    std::mutex callMtx_;
+
+private:
+    void workerLoop();
+    static void runChunks(Job &job);
+};
+
+} // namespace sdl3
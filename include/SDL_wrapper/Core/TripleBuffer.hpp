@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace sdl3
+{
+
+// Тройной буфер для передачи снимков от одного писателя одному читателю без блокировок.
+// Писатель заполняет write() и вызывает publish(); читатель вызывает acquire() и получает
+// последний опубликованный целый снимок. Ни одна сторона не ждёт другую.
+template <typename T>
+class TripleBuffer
+{
+public:
+    // Писатель: буфер, недоступный читателю
+    T &write() noexcept
+    {
+        return buffers_[back_];
+    }
+
+    void publish() noexcept
+    {
+        back_ = middle_.exchange(back_ | freshBit, std::memory_order_acq_rel) & indexMask;
+    }
+
+    // Читатель: обновляет свой буфер, если есть новый снимок. true - снимок сменился
+    bool update() noexcept
+    {
+        if (!(middle_.load(std::memory_order_relaxed) & freshBit))
+            return false;
+        front_ = middle_.exchange(front_, std::memory_order_acq_rel) & indexMask;
+        return true;
+    }
+
+    const T &read() const noexcept
+    {
+        return buffers_[front_];
+    }
+
+    const T &acquire() noexcept
+    {
+        update();
+        return read();
+    }
+
+private:
+    static constexpr std::uint32_t indexMask = 3;
+    static constexpr std::uint32_t freshBit = 4;
+
+    std::array<T, 3> buffers_{};
+
+    alignas(64) std::atomic<std::uint32_t> middle_ = 1;
+    alignas(64) std::uint32_t back_ = 2;
+    alignas(64) std::uint32_t front_ = 0;
+};
+
+} // namespace sdl3
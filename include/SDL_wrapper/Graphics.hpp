@@ -2,15 +2,26 @@
 
 #include <SDL_wrapper/Core.hpp>
 
+#include <SDL_wrapper/Graphics/CollisionWorld.hpp>
+#include <SDL_wrapper/Graphics/Image.hpp>
+#include <SDL_wrapper/Graphics/PickingTree.hpp>
 #include <SDL_wrapper/Graphics/Texture.hpp>
+#include <SDL_wrapper/Graphics/DrawTransformObjects/AnimatedSprite.hpp>
 #include <SDL_wrapper/Graphics/DrawTransformObjects/CircleShape.hpp>
 #include <SDL_wrapper/Graphics/DrawTransformObjects/EllipseShape.hpp>
+#include <SDL_wrapper/Graphics/DrawTransformObjects/InstancedMesh.hpp>
+#include <SDL_wrapper/Graphics/DrawTransformObjects/NineSliceSprite.hpp>
 #include <SDL_wrapper/Graphics/DrawTransformObjects/PolygonShape.hpp>
+#include <SDL_wrapper/Graphics/DrawTransformObjects/Polyline.hpp>
 #include <SDL_wrapper/Graphics/DrawTransformObjects/RectangleShape.hpp>
 #include <SDL_wrapper/Graphics/DrawTransformObjects/Sprite.hpp>
 #include <SDL_wrapper/Graphics/ObjectBase/Drawable.hpp>
+#include <SDL_wrapper/Graphics/ObjectBase/Pickable.hpp>
 #include <SDL_wrapper/Graphics/ObjectBase/Shape.hpp>
 #include <SDL_wrapper/Graphics/ObjectBase/Transformable.hpp>
+#include <SDL_wrapper/Graphics/Renders/FrameCapture.hpp>
+#include <SDL_wrapper/Graphics/Renders/RenderContext.hpp>
+#include <SDL_wrapper/Graphics/Renders/RenderSurface.hpp>
 #include <SDL_wrapper/Graphics/Renders/RenderTarget.hpp>
 #include <SDL_wrapper/Graphics/Renders/RenderWindow.hpp>
 #include <SDL_wrapper/Graphics/Renders/VideoMode.hpp>
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <SDL_wrapper/Graphics/Export.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <SDL_wrapper/Core/Names.hpp>
+#include <SDL_wrapper/Core/SmallVector.hpp>
+#include <SDL_wrapper/Graphics/ObjectBase/Pickable.hpp>
+
+namespace sdl3
+{
+
+class AnimatedSprite;
+class Shape;
+class Sprite;
+
+// Поиск столкновений: широкая фаза - sweep-and-prune по глобальным рамкам вдоль оси X,
+// узкая - теорема о разделяющей оси. Концы рамок хранятся отсортированными между кадрами
+// и досортировываются вставками: при малых сдвигах это почти линейный проход.
+// Невыпуклые фигуры проверяются по треугольникам своей сетки, обводка не учитывается.
+// Мир хранит указатели: объект нужно удалить из мира до его разрушения.
+class SDL_WRAPPER_GRAPHICS_EXPORT CollisionWorld
+{
+public:
+    using Id = std::size_t;
+
+    static constexpr Id invalidId = Id(-1);
+
+    struct Pair
+    {
+        Id first = invalidId;
+        Id second = invalidId;
+    };
+
+public:
+    Id insert(const Shape &shape);
+    Id insert(const Sprite &sprite);
+    Id insert(const AnimatedSprite &sprite);
+    bool remove(Id id);
+    void clear();
+
+    std::size_t getSize() const;
+    const Pickable *getObject(Id id) const;
+
+    // Обновляет рамки изменившихся объектов, досортировывает концы и собирает пары. Раз за тик
+    void update();
+
+    // Пары с пересекающимися рамками (first < second)
+    std::span<const Pair> getBroadPhasePairs() const;
+    // Пары, прошедшие точную проверку
+    std::span<const Pair> getCollisions() const;
+
+    // Точная проверка двух объектов мира по текущей геометрии
+    bool testCollision(Id first, Id second);
+
+private:
+    enum class Kind : std::uint8_t
+    {
+        Shape,
+        Sprite,
+        AnimatedSprite
+    };
+
+    struct Box
+    {
+        float minX = 0.f;
+        float minY = 0.f;
+        float maxX = 0.f;
+        float maxY = 0.f;
+    };
+
+    struct Body
+    {
+        const Pickable *object = nullptr;
+        Kind kind = Kind::Shape;
+        Box box;
+        unsigned version = 0;
+
+        // Вершины в глобальных координатах; пересчитываются по версии только для тел из пар
+        SmallVector<Vector2f, 8> world;
+        unsigned worldVersion = 0;
+        bool worldValid = false;
+    };
+
+    // Активный интервал держит свои Y рядом: проход по активным не прыгает по телам
+    struct ActiveEntry
+    {
+        std::uint32_t body = 0;
+        float minY = 0.f;
+        float maxY = 0.f;
+    };
+
+    struct Endpoint
+    {
+        float value = 0.f;
+        std::uint32_t body = 0;
+        bool isMax = false;
+    };
+
+    std::vector<Body> bodies_;
+    std::vector<Id> freeIds_;
+    std::size_t liveCount_ = 0;
+
+    std::vector<Endpoint> endpoints_;
+    bool endpointsDirty_ = false;
+
+    std::vector<ActiveEntry> active_;
+    std::vector<std::uint32_t> activeSlot_;
+
+    std::vector<Pair> broadPairs_;
+    std::vector<Pair> collisions_;
+
+private:
+    Id insertBody(const Pickable &object, Kind kind);
+
+    static Box toBox(const FloatRect &rect);
+    static bool endpointLess(const Endpoint &a, const Endpoint &b);
+
+    void rebuildEndpoints();
+    void sortEndpoints();
+    void sweep();
+
+    const Body *prepareWorld(Id id);
+    static void appendTriangle(const Body &body, const std::vector<int> &indices, std::size_t first, Vector2f (&out)[3]);
+    bool testBodies(Id first, Id second);
+};
+
+} // namespace sdl3
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <SDL3/SDL_pixels.h>
+#include <SDL3/SDL_render.h>
+
+#include <SDL_wrapper/Core/FrameArena.hpp>
+#include <SDL_wrapper/Core/Names.hpp>
+
+namespace sdl3
+{
+class RenderTarget;
+}
+
+namespace sdl3::detail
+{
+
+// Записанная команда рендера. Диапазоны указывают в общие массивы CommandList
+struct RenderCommand
+{
+    enum class Type : unsigned char
+    {
+        Clear,
+        Geometry
+    };
+
+    Type type = Type::Geometry;
+    int texture = -1; // индекс в CommandList::textures, -1 - без текстуры
+    SDL_FColor color{};
+
+    int firstVertex = 0;
+    int vertexCount = 0;
+    int firstIndex = 0;
+    int indexCount = 0;
+};
+
+// Кадр целиком: команды и их вершины. Текстуры удерживаются до конца воспроизведения,
+// поэтому Texture::clear или уничтожение Texture между записью и показом безопасны.
+// Массивы живут в собственной арене списка и сбрасываются вместе с ней.
+struct CommandList
+{
+    FrameArena arena;
+
+    std::pmr::vector<RenderCommand> commands{&arena};
+    std::pmr::vector<std::shared_ptr<SDL_Texture>> textures{&arena};
+
+    std::pmr::vector<Vector2f> positions{&arena};
+    std::pmr::vector<SDL_FColor> colors{&arena};
+    std::pmr::vector<Vector2f> uv{&arena};
+    std::pmr::vector<int> indices{&arena};
+
+    void clear();
+};
+
+// Двойной буфер команд и поток, который воспроизводит готовый кадр, пока записывается следующий
+class RenderQueue
+{
+    friend class sdl3::RenderTarget;
+
+public:
+    RenderQueue(std::shared_ptr<SDL_Renderer> renderer, std::shared_ptr<std::recursive_mutex> rendererMtx);
+    ~RenderQueue();
+
+    RenderQueue(const RenderQueue &) = delete;
+    RenderQueue &operator=(const RenderQueue &) = delete;
+
+    static Vector2f queryTargetCenter(SDL_Renderer *renderer);
+
+private:
+    std::shared_ptr<SDL_Renderer> renderer_;
+    std::shared_ptr<std::recursive_mutex> rendererMtx_;
+
+    CommandList lists_[2];
+    std::size_t recordIndex_ = 0;
+
+    std::thread thread_;
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    bool pending_ = false;
+    bool stop_ = false;
+
+    // Центр цели снимается потоком рендера после каждого кадра: из записывающего потока SDL не вызывается
+    mutable std::mutex centerMtx_;
+    Vector2f targetCenter_{};
+
+private:
+    CommandList &recording();
+
+    // Отдаёт записанный кадр потоку рендера; ждёт, только если он ещё занят предыдущим
+    void submitFrame();
+    // Блокирует до воспроизведения всего отданного
+    void waitIdle();
+
+    Vector2f getTargetCenter() const;
+
+    void threadLoop();
+    void replay(const CommandList &list);
+};
+
+} // namespace sdl3::detail
@@ -1,14 +1,17 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <mutex>
-#include <unordered_map>
 
 #include <SDL3/SDL_render.h>
 
+#include <SDL_wrapper/Core/Detail/SlotMap.hpp>
+
 namespace sdl3
 {
+class RenderSurface;
 class RenderWindow;
 class Texture;
 }
@@ -18,28 +21,37 @@ namespace sdl3::detail
 
 class RendererRegistry
 {
+    friend class sdl3::RenderSurface;
     friend class sdl3::RenderWindow;
     friend class sdl3::Texture;
 
 private:
-    struct Storage
+    struct Entry
     {
-        std::unordered_map<std::size_t, std::weak_ptr<SDL_Renderer>> renderers;
-        std::size_t nextRendererId = 0;
-        std::size_t usersCount = 0;
-        std::mutex mtx;
+        std::weak_ptr<SDL_Renderer> renderer;
+        // Сериализует вызовы SDL_Renderer между потоком рендера и загрузкой/удалением текстур
+        std::shared_ptr<std::recursive_mutex> rendererMtx;
+        // Масштаб дисплея окна для выбора вариантов name@Nx; обновляет RenderWindow::pollEvents
+        std::shared_ptr<std::atomic<float>> density;
     };
 
-    inline static Storage* s_ = nullptr;
+    using Storage = SlotMap<Entry>;
 
-    inline static constexpr std::size_t invalidID = std::size_t(-1);
+    inline static constexpr std::size_t invalidID = Storage::invalidId;
 
 private:
-    static Storage* storageOrNull_NoInit() noexcept;
+    static Storage &storage();
 
-    static std::size_t subscribeRenderer(std::shared_ptr<SDL_Renderer> renderer);
+    static std::size_t subscribeRenderer(std::shared_ptr<SDL_Renderer> renderer,
+                                         std::shared_ptr<std::recursive_mutex> rendererMtx,
+                                         std::shared_ptr<std::atomic<float>> density = nullptr);
     static void unsubscribeRenderer(std::size_t id) noexcept;
     static std::weak_ptr<SDL_Renderer> getRenderer(std::size_t id) noexcept;
+    static std::shared_ptr<std::recursive_mutex> getRendererMutex(std::size_t id) noexcept;
+    // 1, если цель не окно
+    static float getDensity(std::size_t id) noexcept;
+    // Открытое окно с наименьшим слотом (RenderSurface не считается); invalidID, если окон нет
+    static std::size_t getPrimaryWindow();
 };
 
 } // namespace sdl3::detail
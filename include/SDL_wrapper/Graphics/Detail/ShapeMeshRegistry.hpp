@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL_wrapper/Core/Names.hpp>
+#include <SDL_wrapper/Core/Rect.hpp>
+#include <SDL_wrapper/Core/SmallVector.hpp>
+
+namespace sdl3
+{
+class Shape;
+}
+
+namespace sdl3::detail
+{
+
+// Параметры, однозначно задающие локальную геометрию фигуры
+struct ShapeMeshKey
+{
+    // Ключ собирается при каждой смене геометрии: типичные фигуры не должны идти в кучу
+    using Points = SmallVector<Vector2f, 8>;
+
+    Points points;
+    std::vector<std::vector<Vector2f>> holes;
+    float outlineThickness = 0.f;
+    FloatRect textureRect{};
+    Vector2i textureSize{};
+
+    bool operator==(const ShapeMeshKey &other) const;
+};
+
+// Неизменяемая локальная геометрия, разделяемая одинаковыми фигурами
+struct ShapeMesh
+{
+    ShapeMeshKey key;
+    std::size_t hash = 0;
+
+    FloatRect localBounds{};
+    FloatRect outerBounds{}; // заливка вместе с обводкой
+    std::vector<Vector2f> vertices;
+    std::vector<Vector2f> textureUV;
+    // Триангуляция зависит только от контуров и разделяется сетками с теми же точками
+    std::shared_ptr<const std::vector<int>> indices;
+    bool convex = false; // выпуклый контур без отверстий: индексы - веер от вершины 0
+    std::vector<Vector2f> outlineVertices;
+};
+
+class ShapeMeshRegistry
+{
+    friend class sdl3::Shape;
+
+private:
+    using Builder = void (*)(ShapeMesh &mesh, const ShapeMesh *previous);
+
+    struct Storage
+    {
+        std::unordered_multimap<std::size_t, std::weak_ptr<const ShapeMesh>> meshes;
+        std::size_t sweepThreshold = minSweepThreshold;
+        std::mutex mtx;
+    };
+
+    inline static constexpr std::size_t minSweepThreshold = 64;
+
+private:
+    static Storage &storage();
+
+    static std::size_t hashKey(const ShapeMeshKey &key) noexcept;
+    static std::shared_ptr<const ShapeMesh> acquire(ShapeMeshKey key, Builder build, const ShapeMesh *previous);
+    static void sweepExpired(Storage &st);
+};
+
+} // namespace sdl3::detail
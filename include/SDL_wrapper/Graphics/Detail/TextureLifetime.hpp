@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+
+#include <SDL_wrapper/Core/Detail/SlotMap.hpp>
+
+namespace sdl3
+{
+class Texture;
+}
+
+namespace sdl3::detail
+{
+
+// Поколенческий ID жизни объекта Texture. Копия и перемещение получают новый ID, присваивание
+// сохраняет свой: ID принадлежит адресу объекта, по которому его и запоминают спрайты
+class TextureLifetime
+{
+public:
+    using Storage = SlotMap<bool>;
+
+    inline static constexpr std::size_t invalidID = Storage::invalidId;
+
+public:
+    // noexcept, чтобы Texture оставалась перемещаемой без исключений (перестановки в vector)
+    TextureLifetime() noexcept;
+    TextureLifetime(const TextureLifetime &) noexcept;
+    TextureLifetime(TextureLifetime &&) noexcept;
+    TextureLifetime &operator=(const TextureLifetime &) noexcept;
+    TextureLifetime &operator=(TextureLifetime &&) noexcept;
+    ~TextureLifetime();
+
+    std::size_t getId() const noexcept;
+
+    static bool isAlive(std::size_t id) noexcept;
+
+private:
+    static Storage &storage();
+    static std::size_t acquire() noexcept;
+
+    // invalidID, если реестр переполнен: такая текстура не проверяется
+    std::size_t id_ = invalidID;
+};
+
+// Ссылка рисуемого объекта на текстуру. В отладочной сборке обращение к уничтоженной Texture
+// даёт nullptr и одно сообщение в лог вместо чтения освобождённой памяти; с NDEBUG - обычный указатель
+class TextureRef
+{
+public:
+    TextureRef() = default;
+    TextureRef(const Texture *texture);
+
+    const Texture *get() const noexcept
+    {
+#ifndef NDEBUG
+        if (texture_ && !checkAlive())
+            return nullptr;
+#endif
+        return texture_;
+    }
+
+    operator const Texture *() const noexcept
+    {
+        return get();
+    }
+
+    const Texture *operator->() const noexcept
+    {
+        return get();
+    }
+
+private:
+    bool checkAlive() const noexcept;
+
+    const Texture *texture_ = nullptr;
+    std::size_t id_ = TextureLifetime::invalidID;
+    mutable bool reported_ = false;
+};
+
+} // namespace sdl3::detail
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <SDL_wrapper/Graphics/Export.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SDL_wrapper/Core/Clock.hpp>
+#include <SDL_wrapper/Core/Math/Colors.hpp>
+#include <SDL_wrapper/Core/Names.hpp>
+#include <SDL_wrapper/Core/Rect.hpp>
+#include <SDL_wrapper/Graphics/Detail/TextureLifetime.hpp>
+#include <SDL_wrapper/Graphics/ObjectBase/Drawable.hpp>
+#include <SDL_wrapper/Graphics/ObjectBase/Pickable.hpp>
+#include <SDL_wrapper/Graphics/ObjectBase/Transformable.hpp>
+
+namespace sdl3
+{
+
+class RenderTarget;
+class Texture;
+
+// Спрайт с покадровой анимацией по листу. UV каждого кадра считаются при добавлении,
+// смена кадра подменяет только UV: экранные вершины пересчитываются лишь при смене размера кадра.
+class SDL_WRAPPER_GRAPHICS_EXPORT AnimatedSprite : public Drawable, public Transformable, public Pickable
+{
+public:
+    AnimatedSprite();
+
+    void setTexture(const Texture &texture);
+    const Texture *getTexture() const;
+
+    void setFilterColor(const Color &color);
+    const Color &getFilterColor() const;
+
+    void addFrame(const FloatRect &rect, float durationS);
+    // frameCount кадров размера frameSize построчно, начиная с start; строки переносятся по ширине текстуры
+    void addFrameGrid(const Vector2i &frameSize, std::size_t frameCount, float frameDurationS, const Vector2i &start = {});
+    void clearFrames();
+    std::size_t getFrameCount() const;
+
+    void setFrame(std::size_t index);
+    std::size_t getFrame() const;
+
+    void play();
+    void pause();
+    void stop();
+    bool isPlaying() const;
+
+    void setLooped(bool looped);
+    bool isLooped() const;
+
+    // Выбирает кадр по часам анимации; вызывается раз за кадр игры
+    void update();
+
+    // Рамка текущего кадра
+    FloatRect getLocalBounds() const;
+    FloatRect getGlobalBounds() const override;
+    bool containsPoint(const Vector2f &point) const override;
+    unsigned getPickVersion() const override;
+
+private:
+    struct Frame
+    {
+        FloatRect rect{};
+        Vector2f uv[4]{};
+        std::uint64_t endNS = 0; // накопленная длительность по этот кадр включительно
+    };
+
+    detail::TextureRef texture_;
+    Color color_ = Colors::White;
+
+    std::vector<Frame> frames_;
+    std::size_t current_ = 0;
+
+    ClockNS clock_;
+    bool playing_ = false;
+    bool looped_ = true;
+
+    Vector2f localVertices_[4]{};
+    unsigned localVersion_ = 0;
+
+    mutable Vector2f vertices_[4]{};
+    mutable int textureLevel_ = 0;
+    mutable bool dirty_ = true;
+
+    static constexpr int indices_[6] = {0, 1, 2, 2, 3, 0};
+
+private:
+    void draw(RenderTarget &target) const override;
+    void prepare(const RenderContext &context) const override;
+
+    void updateFrameUV(Frame &frame) const;
+    void updateLocalVertices();
+};
+
+} // namespace sdl3
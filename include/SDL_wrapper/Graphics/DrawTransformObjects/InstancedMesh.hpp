@@ -0,0 +1,91 @@
+#pragma once
+
+#include <SDL_wrapper/Graphics/Export.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include <SDL_wrapper/Core/Math/Colors.hpp>
+#include <SDL_wrapper/Core/Names.hpp>
+#include <SDL_wrapper/Graphics/Detail/TextureLifetime.hpp>
+#include <SDL_wrapper/Graphics/ObjectBase/Drawable.hpp>
+#include <SDL_wrapper/Graphics/ObjectBase/Transformable.hpp>
+
+namespace sdl3
+{
+
+class RenderTarget;
+class Shape;
+class Texture;
+
+// Экземпляр сетки: поворот в градусах вокруг локального нуля сетки, цвет умножается на цвета вершин
+struct MeshInstance
+{
+    Vector2f position = {};
+    Vector2f scale = {1.f, 1.f};
+    float rotation = 0.f;
+    Color color = Colors::White;
+};
+
+// Одна локальная сетка во многих местах за один вызов геометрии. Вершины всех экземпляров лежат
+// в общем буфере: изменение экземпляра пересчитывает только его участок, смена вида или общего
+// трансформа - все. Экземпляры рисуются по порядку, трансформ объекта применяется поверх их собственного.
+class SDL_WRAPPER_GRAPHICS_EXPORT InstancedMesh : public Drawable, public Transformable
+{
+public:
+    InstancedMesh() = default;
+
+    // Снимок локальной сетки фигуры вместе с её текстурой и цветами; последующие изменения фигуры
+    // не отслеживаются. Обводка берётся только у фигур без текстуры - вызов один, текстура на всех одна
+    void setMesh(const Shape &shape);
+    // Треугольники по indices; colors и uv - по одному на вершину или пустые (белый цвет, без UV)
+    void setMesh(std::vector<Vector2f> vertices, std::vector<int> indices,
+                 std::vector<Color> colors = {}, std::vector<Vector2f> uv = {});
+
+    void setTexture(const Texture *texture);
+    const Texture *getTexture() const;
+
+    std::size_t addInstance(const MeshInstance &instance);
+    void setInstance(std::size_t index, const MeshInstance &instance);
+    const MeshInstance &getInstance(std::size_t index) const;
+    // На место удалённого переносится последний экземпляр
+    void removeInstance(std::size_t index);
+    void setInstances(std::vector<MeshInstance> instances);
+    void clearInstances();
+    void reserveInstances(std::size_t count);
+
+    std::size_t getInstanceCount() const;
+    const std::vector<MeshInstance> &getInstances() const;
+
+private:
+    std::vector<Vector2f> localVertices_;
+    std::vector<Color> localColors_;
+    std::vector<Vector2f> localUV_;
+    std::vector<int> localIndices_;
+    detail::TextureRef texture_;
+
+    std::vector<MeshInstance> instances_;
+
+    // Изменённые экземпляры без повторов; allDirty_ - пересчитать всё
+    mutable std::vector<std::size_t> dirtyList_;
+    mutable std::vector<unsigned char> dirtyFlags_;
+    mutable bool allDirty_ = true;
+    mutable bool layoutDirty_ = true; // сменилась сетка: UV и индексы собираются заново
+
+    mutable std::vector<Vector2f> vertices_;
+    mutable std::vector<Color> colors_;
+    mutable std::vector<Vector2f> uv_;
+    mutable std::vector<int> indices_;
+    mutable std::size_t builtInstances_ = 0;
+
+private:
+    void draw(RenderTarget &target) const override;
+    void prepare(const RenderContext &context) const override;
+
+    void markDirty(std::size_t index);
+    bool needsUpdate() const;
+    void resizeBuffers() const;
+    void expandInstance(std::size_t index, const Matrix3x3<float> &base) const;
+};
+
+} // namespace sdl3
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <SDL_wrapper/Graphics/Export.hpp>
+
+#include <array>
+
+#include <SDL_wrapper/Core/Rect.hpp>
+#include <SDL_wrapper/Core/Names.hpp>
+#include <SDL_wrapper/Core/Math/Colors.hpp>
+#include <SDL_wrapper/Graphics/Detail/TextureLifetime.hpp>
+#include <SDL_wrapper/Graphics/ObjectBase/Drawable.hpp>
+#include <SDL_wrapper/Graphics/ObjectBase/Pickable.hpp>
+#include <SDL_wrapper/Graphics/ObjectBase/Transformable.hpp>
+
+namespace sdl3
+{
+
+class RenderTarget;
+class Texture;
+
+// Отступы рамки в пикселях текстуры
+struct SliceInsets
+{
+    float left = 0.f;
+    float top = 0.f;
+    float right = 0.f;
+    float bottom = 0.f;
+};
+
+// Растягиваемая панель из девяти частей: углы сохраняют размер, стороны тянутся по одной оси,
+// центр - по обеим. Сетка 4x4 вершины, 54 индекса, один вызов drawShape.
+// Если размер меньше суммы отступов, отступы пропорционально уменьшаются.
+class SDL_WRAPPER_GRAPHICS_EXPORT NineSliceSprite : public Drawable, public Transformable, public Pickable
+{
+public:
+    NineSliceSprite() = default;
+    NineSliceSprite(const Texture &texture, const SliceInsets &insets);
+
+    void setFilterColor(const Color &color);
+    const Color &getFilterColor() const;
+
+    // Размер по умолчанию - размер прямоугольника текстуры
+    void setTexture(const Texture &texture);
+    void setTexture(const Texture &texture, const FloatRect &textureRect);
+    void setTextureRect(const FloatRect &textureRect);
+
+    const Texture *getTexture() const;
+    const FloatRect &getTextureRect() const;
+
+    void setInsets(const SliceInsets &insets);
+    const SliceInsets &getInsets() const;
+
+    void setSize(const Vector2f &size);
+    const Vector2f &getSize() const;
+
+    FloatRect getLocalBounds() const;
+    FloatRect getGlobalBounds() const override;
+    bool containsPoint(const Vector2f &point) const override;
+    unsigned getPickVersion() const override;
+
+private:
+    static constexpr int gridSize = 4;
+    static constexpr int vertexCount = gridSize * gridSize;
+    static constexpr int indexCount = 9 * 6;
+
+    detail::TextureRef texture_;
+    FloatRect textureRect_{};
+    SliceInsets insets_{};
+    Vector2f size_{};
+
+    Color color_ = Colors::White;
+
+    Vector2f localVertices_[vertexCount]{};
+    Vector2f textureUV_[vertexCount]{};
+
+    mutable Vector2f vertices_[vertexCount]{};
+    mutable bool dirty_ = false;
+    unsigned localVersion_ = 0;
+
+    static const std::array<int, indexCount> indices_;
+
+private:
+    void draw(RenderTarget &target) const override;
+    void prepare(const RenderContext &context) const override;
+    void updateLocalGeometry();
+    void updateTextureCoords();
+    void updateVertices(const Matrix3x3<float> &matrix) const;
+};
+
+} // namespace sdl3
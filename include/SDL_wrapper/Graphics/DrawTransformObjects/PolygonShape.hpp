@@ -3,6 +3,7 @@
 #include <SDL_wrapper/Graphics/Export.hpp>
 
 #include <cstddef>
+#include <span>
 #include <vector>
 
 #include <SDL_wrapper/Graphics/ObjectBase/Shape.hpp>
@@ -22,12 +23,21 @@ public:
 
     const std::vector<Vector2f> &getPoints() const;
 
+    // Отверстия - простые контуры внутри внешнего, в тех же локальных координатах
+    void setHoles(std::vector<std::vector<Vector2f>> holes);
+
+    const std::vector<std::vector<Vector2f>> &getHoles() const;
+
     std::size_t getPointCount() const override;
 
     Vector2f getPoint(const std::size_t index) const override;
 
+protected:
+    std::span<const std::vector<Vector2f>> getLocalHoles() const override;
+
 private:
     std::vector<Vector2f> points_;
+    std::vector<std::vector<Vector2f>> holes_;
 };
 
 } // namespace sdl3
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <SDL_wrapper/Graphics/Export.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include <SDL_wrapper/Core/Math/Colors.hpp>
+#include <SDL_wrapper/Core/Names.hpp>
+#include <SDL_wrapper/Graphics/ObjectBase/Drawable.hpp>
+#include <SDL_wrapper/Graphics/ObjectBase/Transformable.hpp>
+
+namespace sdl3
+{
+
+class RenderTarget;
+
+enum class LineJoin : unsigned char
+{
+    Miter,
+    Bevel,
+    Round
+};
+
+enum class LineCap : unsigned char
+{
+    Butt,
+    Square,
+    Round
+};
+
+class SDL_WRAPPER_GRAPHICS_EXPORT Polyline : public Drawable, public Transformable
+{
+public:
+    Polyline() = default;
+    explicit Polyline(std::vector<Vector2f> points, float width = 1.f);
+
+    void setPoints(std::vector<Vector2f> points);
+    void addPoint(const Vector2f &point);
+    void clearPoints();
+    const std::vector<Vector2f> &getPoints() const;
+
+    void setWidth(float width);
+    float getWidth() const;
+
+    void setJoin(LineJoin join);
+    LineJoin getJoin() const;
+
+    void setCap(LineCap cap);
+    LineCap getCap() const;
+
+    void setMiterLimit(float limit);
+    float getMiterLimit() const;
+
+    void setColor(const Color &color);
+    const Color &getColor() const;
+
+private:
+    std::vector<Vector2f> points_;
+    float width_ = 1.f;
+    float miterLimit_ = 4.f;
+    LineJoin join_ = LineJoin::Miter;
+    LineCap cap_ = LineCap::Butt;
+    Color color_ = Colors::White;
+
+    unsigned strokeVersion_ = 0;
+
+    mutable std::vector<Vector2f> localVertices_;
+    mutable std::vector<int> indices_;
+    mutable std::vector<Vector2f> vertices_;
+    mutable unsigned tessellatedVersion_ = static_cast<unsigned>(-1);
+    mutable bool dirty_ = true;
+
+private:
+    void draw(RenderTarget &target) const override;
+    void prepare(const RenderContext &context) const override;
+
+    void tessellate() const;
+    void updateVertices(const Matrix3x3<float> &matrix) const;
+};
+
+} // namespace sdl3
@@ -6,7 +6,9 @@
 #include <SDL_wrapper/Core/Rect.hpp>
 #include <SDL_wrapper/Core/Names.hpp>
 #include <SDL_wrapper/Core/Math/Colors.hpp>
+#include <SDL_wrapper/Graphics/Detail/TextureLifetime.hpp>
 #include <SDL_wrapper/Graphics/ObjectBase/Drawable.hpp>
+#include <SDL_wrapper/Graphics/ObjectBase/Pickable.hpp>
 #include <SDL_wrapper/Graphics/ObjectBase/Transformable.hpp>
 
 namespace sdl3
@@ -15,7 +17,7 @@ namespace sdl3
 class RenderTarget;
 class Texture;
 
-class SDL_WRAPPER_GRAPHICS_EXPORT Sprite : public Drawable, public Transformable
+class SDL_WRAPPER_GRAPHICS_EXPORT Sprite : public Drawable, public Transformable, public Pickable
 {
 public:
     Sprite() = default;
@@ -33,8 +35,13 @@ public:
     void setCenterPosition(const Vector2f &position);
     Vector2f getCenterPosition() const;
 
+    FloatRect getLocalBounds() const;
+    FloatRect getGlobalBounds() const override;
+    bool containsPoint(const Vector2f &point) const override;
+    unsigned getPickVersion() const override;
+
 private:
-    const Texture *texture_ = nullptr;
+    detail::TextureRef texture_;
     FloatRect textureRect_{};
 
     Color color_ = Colors::White;
@@ -43,12 +50,15 @@ private:
     Vector2f textureUV_[4]{};
 
     mutable Vector2f vertices_[4]{};
+    mutable int textureLevel_ = 0;
     mutable bool dirty_ = false;
+    unsigned localVersion_ = 0;
 
     static constexpr int indices_[6] = {0, 1, 2, 2, 3, 0};
 
 private:
     void draw(RenderTarget &target) const override;
+    void prepare(const RenderContext &context) const override;
     void updateLocalGeometry();
     void updateVertices(const Matrix3x3<float> &matrix) const;
 };
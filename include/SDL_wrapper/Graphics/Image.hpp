@@ -0,0 +1,46 @@
+#pragma once
+
+#include <SDL_wrapper/Graphics/Export.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SDL_wrapper/Core/Math/Colors.hpp>
+#include <SDL_wrapper/Core/Names.hpp>
+
+namespace sdl3
+{
+
+// Изображение в оперативной памяти: плотно упакованные пиксели RGBA32 (байты R, G, B, A), строка = width * 4.
+// Буфер переиспользуется: create() того же или меньшего размера не обращается к куче.
+class SDL_WRAPPER_GRAPHICS_EXPORT Image
+{
+public:
+    static constexpr std::size_t bytesPerPixel = 4;
+
+public:
+    Image() = default;
+
+    void create(const Vector2i &size, const Color &color = Colors::Black);
+    void clear();
+
+    bool loadFromFile(const char *fileName);
+    // Формат по расширению: .png (SDL3_image), иначе BMP
+    bool saveToFile(const char *fileName) const;
+
+    const Vector2i &getSize() const;
+    std::size_t getPitch() const;
+
+    const std::uint8_t *getPixels() const;
+    std::uint8_t *getPixels();
+
+    Color getPixel(const Vector2i &position) const;
+    void setPixel(const Vector2i &position, const Color &color);
+
+private:
+    std::vector<std::uint8_t> pixels_;
+    Vector2i size_ = {};
+};
+
+} // namespace sdl3
@@ -2,6 +2,8 @@
 
 #include <SDL_wrapper/Graphics/Export.hpp>
 
+#include <SDL_wrapper/Graphics/Renders/RenderContext.hpp>
+
 namespace sdl3
 {
 
@@ -19,6 +21,12 @@ public:
 protected:
     virtual void draw(RenderTarget &target) const = 0;
 
+    // Пересчёт кэшей вершин под контекст без обращений к SDL. RenderTarget::prepare вызывает его
+    // параллельно для разных объектов, поэтому трогать можно только собственное mutable-состояние.
+    virtual void prepare(const RenderContext &/*context*/) const
+    {
+    }
+
 protected:
 
     mutable unsigned viewID_ = static_cast<unsigned>(-1);
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <SDL_wrapper/Graphics/Export.hpp>
+
+#include <SDL_wrapper/Core/Names.hpp>
+#include <SDL_wrapper/Core/Rect.hpp>
+
+namespace sdl3
+{
+
+// Объект, который можно выбрать указателем через PickingTree.
+// Все координаты глобальные: после трансформации объекта, до вида.
+class SDL_WRAPPER_GRAPHICS_EXPORT Pickable
+{
+public:
+    virtual ~Pickable() = default;
+
+    virtual FloatRect getGlobalBounds() const = 0;
+
+    // Точная проверка по геометрии объекта
+    virtual bool containsPoint(const Vector2f &point) const = 0;
+
+    // Меняется при любом изменении формы или трансформации; по ней дерево обновляет рамку
+    virtual unsigned getPickVersion() const = 0;
+};
+
+} // namespace sdl3
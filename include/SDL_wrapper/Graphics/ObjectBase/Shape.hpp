@@ -2,22 +2,34 @@
 
 #include <SDL_wrapper/Graphics/Export.hpp>
 
+#include <memory>
+#include <span>
 #include <vector>
 
 #include <SDL_wrapper/Core/Rect.hpp>
 #include <SDL_wrapper/Core/Names.hpp>
+#include <SDL_wrapper/Core/SmallVector.hpp>
 #include <SDL_wrapper/Core/Math/Colors.hpp>
+#include <SDL_wrapper/Graphics/Detail/ShapeMeshRegistry.hpp>
+#include <SDL_wrapper/Graphics/Detail/TextureLifetime.hpp>
 #include <SDL_wrapper/Graphics/ObjectBase/Drawable.hpp>
+#include <SDL_wrapper/Graphics/ObjectBase/Pickable.hpp>
 #include <SDL_wrapper/Graphics/ObjectBase/Transformable.hpp>
 
 namespace sdl3
 {
 
+class CollisionWorld;
+class InstancedMesh;
 class RenderTarget;
 class Texture;
 
-class SDL_WRAPPER_GRAPHICS_EXPORT Shape : public Drawable, public Transformable
+class SDL_WRAPPER_GRAPHICS_EXPORT Shape : public Drawable, public Transformable, public Pickable
 {
+    // Узкая фаза и экземпляры берут разделяемую локальную сетку без пересборки
+    friend class CollisionWorld;
+    friend class InstancedMesh;
+
 public:
     virtual ~Shape() = default;
 
@@ -38,34 +50,46 @@ public:
     void setTexture(const Texture &texture);
     void setTextureRect(const FloatRect &rect);
 
+    // Рамка заливки и обводки в локальных координатах
+    FloatRect getLocalBounds() const;
+    FloatRect getGlobalBounds() const override;
+    // Попадание в треугольники заливки или обводки
+    bool containsPoint(const Vector2f &point) const override;
+    unsigned getPickVersion() const override;
+
 protected:
     void updateLocalGeometry();
 
+    // Контуры отверстий в локальных координатах; у базовых фигур их нет
+    virtual std::span<const std::vector<Vector2f>> getLocalHoles() const;
+
 private:
-    const Texture *texture_ = nullptr;
+    detail::TextureRef texture_;
     FloatRect textureRect_ = {0, 0, 0, 0};
 
     Color fillColor_ = {1.0f, 1.0f, 1.0f, 1.0f};
     Color outlineColor_ = {1.0f, 1.0f, 1.0f, 1.0f};
     float outlineThickness_ = 0.0f;
 
-    FloatRect localBounds_{};
-    std::vector<Vector2f> textureUV_;
-    std::vector<Vector2f> localVertices_;
-    std::vector<Vector2f> localOutlineVertices_;
+    std::shared_ptr<const detail::ShapeMesh> mesh_;
+    unsigned localVersion_ = 0;
 
-    mutable std::vector<Vector2f> vertices_;
-    mutable std::vector<Vector2f> outlineVertices_;
+    // Прямоугольник и небольшие многоугольники целиком помещаются во встроенные буферы
+    mutable SmallVector<Vector2f, 16> vertices_;
+    mutable SmallVector<Vector2f, 24> outlineVertices_;
+    mutable int textureLevel_ = 0;
     mutable bool shapeDirty_ = true;
     mutable bool outlineDirty_ = true;
 
 private:
     void draw(RenderTarget &target) const override;
+    void prepare(const RenderContext &context) const override;
 
-    void updateLocalShape();
-    void updateLocalOutline();
-    void updateLocalBounds();
-    void updateTexturePoints();
+    static void buildLocalMesh(detail::ShapeMesh &mesh, const detail::ShapeMesh *previous);
+    static void buildLocalShape(detail::ShapeMesh &mesh);
+    static void buildLocalIndices(detail::ShapeMesh &mesh, const detail::ShapeMesh *previous);
+    static void buildLocalOutline(detail::ShapeMesh &mesh);
+    static void buildLocalBounds(detail::ShapeMesh &mesh);
 
     void updateVertices(const Matrix3x3<float> &matrix) const;
     void updateOutlineVertices(const Matrix3x3<float> &matrix) const;
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <SDL_wrapper/Graphics/Export.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SDL_wrapper/Core/Names.hpp>
+#include <SDL_wrapper/Graphics/ObjectBase/Pickable.hpp>
+
+namespace sdl3
+{
+
+// Выбор объекта под точкой: BVH по глобальным рамкам и точная проверка кандидатов.
+// Рамки сверяются с Pickable::getPickVersion(): сдвинутые объекты подгоняют узлы дерева (refit),
+// а когда сдвинулась заметная доля объектов или состав изменился - дерево перестраивается.
+// Дерево хранит указатели: объект нужно удалить из дерева до его разрушения.
+class SDL_WRAPPER_GRAPHICS_EXPORT PickingTree
+{
+public:
+    using Id = std::size_t;
+
+    static constexpr Id invalidId = Id(-1);
+
+public:
+    // drawOrder - порядок отрисовки: больше значит выше; при равенстве выше добавленный позже
+    Id insert(const Pickable &object, int drawOrder = 0);
+    bool remove(Id id);
+    void clear();
+
+    void setDrawOrder(Id id, int drawOrder);
+    std::size_t getSize() const;
+
+    // Сверка версий всех объектов и подгонка дерева - O(n), вызывается раз за кадр до pick()
+    void update();
+
+    // Верхний объект под точкой в глобальных координатах или nullptr. Рамки берутся
+    // на момент последнего update(); сам запрос - O(log n + число кандидатов)
+    const Pickable *pick(const Vector2f &point) const;
+    // Все объекты под точкой, сверху вниз
+    void pickAll(const Vector2f &point, std::vector<const Pickable *> &out) const;
+
+private:
+    struct Box
+    {
+        float minX = 0.f;
+        float minY = 0.f;
+        float maxX = 0.f;
+        float maxY = 0.f;
+    };
+
+    struct Entry
+    {
+        const Pickable *object = nullptr;
+        Box box;
+        unsigned version = 0;
+        int drawOrder = 0;
+        std::uint64_t sequence = 0;
+    };
+
+    // Лист: count > 0, объекты items_[first, first + count). Узел: count == 0, дети first и first + 1
+    struct Node
+    {
+        Box box;
+        std::uint32_t first = 0;
+        std::uint32_t count = 0;
+    };
+
+    static constexpr std::uint32_t leafSize = 4;
+
+    std::vector<Entry> entries_;
+    std::vector<Id> freeIds_;
+    std::size_t liveCount_ = 0;
+    std::uint64_t nextSequence_ = 0;
+
+    std::vector<Node> nodes_;
+    std::vector<std::uint32_t> items_;
+    std::size_t movedSinceBuild_ = 0;
+    bool structureDirty_ = false;
+
+    mutable std::vector<std::uint32_t> candidates_;
+
+private:
+    static Box toBox(const FloatRect &rect);
+    static bool contains(const Box &box, const Vector2f &point);
+    static void expand(Box &box, const Box &other);
+
+    bool isAbove(std::uint32_t left, std::uint32_t right) const;
+
+    void rebuild();
+    void refit();
+    void collectCandidates(const Vector2f &point) const;
+};
+
+} // namespace sdl3
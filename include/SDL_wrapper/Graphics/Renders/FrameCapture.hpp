@@ -0,0 +1,101 @@
+#pragma once
+
+#include <SDL_wrapper/Graphics/Export.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <SDL_wrapper/Core/FileWorker.hpp>
+#include <SDL_wrapper/Graphics/Image.hpp>
+
+namespace sdl3
+{
+
+class RenderTarget;
+
+enum class CaptureFormat : unsigned char
+{
+    Y4m, // YUV4MPEG2 4:4:4, BT.601 - читается ffmpeg и большинством кодеров
+    Raw  // сырые кадры RGBA32 подряд, без заголовков
+};
+
+// Захват кадров без остановки цикла рендера. Кадр копируется в буфер из пула прямо перед показом,
+// а кодирование и запись идут в фоновом потоке. Если все буферы заняты (диск не успевает),
+// кадр пропускается и учитывается в getDroppedFrames() - display() никогда не ждёт записи.
+// Подключается через RenderTarget::setFrameCapture(); методы вызываются из потока рендера.
+class SDL_WRAPPER_GRAPHICS_EXPORT FrameCapture
+{
+public:
+    explicit FrameCapture(std::size_t bufferCount = 4);
+    ~FrameCapture();
+
+    FrameCapture(const FrameCapture &) = delete;
+    FrameCapture &operator=(const FrameCapture &) = delete;
+
+    // Поток кадров в файл; fps пишется в заголовок Y4M. Размер фиксируется по первому кадру,
+    // кадры другого размера пропускаются
+    bool openStream(const std::string &fileName, CaptureFormat format = CaptureFormat::Y4m, int fps = 60);
+    // Дописывает накопленные кадры и закрывает файл
+    void closeStream();
+    bool isStreaming() const;
+
+    // Снимок следующего показанного кадра в файл (.png или BMP, см. Image::saveToFile)
+    void requestScreenshot(std::string fileName);
+
+    // Блокирует до записи всех принятых кадров
+    void flush();
+
+    bool wantsFrame() const;
+    // Вызывается целью из display(): копирует задний буфер или пропускает кадр
+    void captureFrame(RenderTarget &target);
+
+    std::uint64_t getCapturedFrames() const;
+    std::uint64_t getDroppedFrames() const;
+
+private:
+    struct Job
+    {
+        std::size_t buffer = 0;
+        std::vector<std::string> screenshots;
+        bool toStream = false;
+    };
+
+    std::vector<Image> buffers_;
+    std::vector<std::size_t> freeBuffers_;
+
+    std::vector<std::string> pendingScreenshots_;
+    bool streaming_ = false;
+
+    // Состояние потока записи; файл и формат трогает только он после openStream
+    FileWorker stream_;
+    CaptureFormat format_ = CaptureFormat::Y4m;
+    int fps_ = 60;
+    Vector2i streamSize_ = {};
+    bool headerWritten_ = false;
+    std::string encodeBuffer_;
+
+    std::uint64_t captured_ = 0;
+    std::uint64_t dropped_ = 0;
+
+    mutable std::mutex mtx_;
+    std::condition_variable wake_;
+    std::condition_variable idle_;
+    std::deque<Job> jobs_;
+    bool busy_ = false;
+    bool stop_ = false;
+    std::thread worker_;
+
+private:
+    void workerLoop();
+    void writeJob(const Job &job);
+    void writeStreamFrame(const Image &image);
+    void encodeY4m(const Image &image);
+};
+
+} // namespace sdl3
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <SDL_wrapper/Core/Math/Matrix3x3.hpp>
+
+namespace sdl3
+{
+
+// Снимок вида цели на момент подготовки кадра. Считается один раз в потоке рендера,
+// дальше только читается - в том числе рабочими потоками в RenderTarget::prepare.
+struct RenderContext
+{
+    // Матрица вида со сдвигом в центр цели: локальные точки * (viewMatrix * transform) = экранные
+    Matrix3x3<float> viewMatrix;
+    unsigned viewId = 0;
+};
+
+} // namespace sdl3
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <SDL_wrapper/Graphics/Export.hpp>
+
+#include <cstddef>
+#include <memory>
+
+#include <SDL3/SDL_surface.h>
+
+#include <SDL_wrapper/Core/Names.hpp>
+#include <SDL_wrapper/Core/Rect.hpp>
+#include <SDL_wrapper/Graphics/Renders/RenderTarget.hpp>
+
+namespace sdl3
+{
+
+// Цель рендера без окна: программный рендер SDL рисует прямо в поверхность RGBA32 в памяти.
+// Не требует видеоподсистемы и GPU, работает с драйвером dummy - для миниатюр и отчётов на сервере.
+// Текстуры для неё загружаются как Texture(surface.getRendererID()).
+class SDL_WRAPPER_GRAPHICS_EXPORT RenderSurface : public RenderTarget
+{
+public:
+    RenderSurface() = default;
+    explicit RenderSurface(const Vector2i &size);
+    ~RenderSurface();
+
+    RenderSurface(const RenderSurface &) = delete;
+    RenderSurface &operator=(const RenderSurface &) = delete;
+
+    bool create(const Vector2i &size);
+    void close();
+    bool isCreated() const;
+
+    std::size_t getRendererID() const;
+    Vector2i getSize() const;
+
+    // Поверхность уже в RGBA32: строки копируются прямо из неё, без SDL_RenderReadPixels
+    using RenderTarget::readPixels;
+    bool readPixels(const IntRect &rect, Image &image) override;
+
+    std::shared_ptr<SDL_Surface> getNativeSDLSurface();
+
+private:
+    std::shared_ptr<SDL_Surface> surface_;
+
+private:
+    void subscribe();
+    void unsubscribe();
+};
+
+} // namespace sdl3
@@ -3,11 +3,21 @@
 #include <SDL_wrapper/Graphics/Export.hpp>
 
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <span>
+#include <vector>
 
 #include <SDL3/SDL_render.h>
 
+#include <SDL_wrapper/Core/FrameArena.hpp>
+#include <SDL_wrapper/Core/FrameLimiter.hpp>
 #include <SDL_wrapper/Core/Math/Colors.hpp>
 #include <SDL_wrapper/Core/Names.hpp>
+#include <SDL_wrapper/Core/Rect.hpp>
+#include <SDL_wrapper/Graphics/Detail/RenderQueue.hpp>
+#include <SDL_wrapper/Graphics/Image.hpp>
+#include <SDL_wrapper/Graphics/Renders/RenderContext.hpp>
 #include <SDL_wrapper/Graphics/Renders/View.hpp>
 #include <SDL_wrapper/Graphics/Texture.hpp>
 
@@ -16,7 +26,9 @@ namespace sdl3
 {
 
 class Drawable;
+class FrameCapture;
 class Texture;
+class ThreadPool;
 
 class SDL_WRAPPER_GRAPHICS_EXPORT RenderTarget
 {
@@ -26,30 +38,119 @@ public:
     void draw(const Drawable &object);
     void draw(const Drawable *object);
 
+    // Двухфазная отрисовка: prepare пересчитывает вершины (параллельно, если передан пул),
+    // submit последовательно и по порядку отдаёт геометрию в SDL. Объект не должен
+    // встречаться в списке дважды, а менять объекты между фазами нельзя.
+    void prepare(std::span<const Drawable *const> objects);
+    void prepare(std::span<const Drawable *const> objects, ThreadPool &pool);
+    void submit(std::span<const Drawable *const> objects);
+
+    // textureLevel - уровень детализации текстуры; UV одни и те же для всех уровней
     void drawShape(const Texture *texture,
                    const Vector2f *positions, int posCnt,
                    const Vector2f *uv, int uvCnt,
                    const Color &color,
-                   const int *indices, int indCnt);
+                   const int *indices, int indCnt,
+                   int textureLevel = 0);
+    // То же с цветом на каждую вершину: для сеток, собранных из многих экземпляров
+    void drawGeometry(const Texture *texture,
+                      const Vector2f *positions, const Color *colors, const Vector2f *uv, int vertexCount,
+                      const int *indices, int indexCount);
 
     const View &getView() const;
     void setView(const View &view);
     unsigned getViewId() const;
     Vector2f getTargetCenter() const;
+    RenderContext getRenderContext() const;
 
     void clear(const Color &color = Colors::Black);
     void display();
 
+    // Режим очереди команд: draw/clear только записывают команды, display отдаёт кадр потоку рендера,
+    // который воспроизводит его, пока записывается следующий. Все вызовы SDL_Renderer тогда идут
+    // из этого потока - включайте режим только на бэкендах, допускающих рендер не из главного потока.
+    void setThreadedRendering(bool enable);
+    bool isThreadedRendering() const;
+
+    // Блокировка рендера для прямых вызовов SDL в обход обёртки, в т.ч. в режиме очереди
+    std::unique_lock<std::recursive_mutex> lockRenderer() const;
+
+    // Память на один кадр: сбрасывается в display(), пригодна для std::pmr-контейнеров
+    FrameArena &getFrameArena();
+
+    // Копирует пиксели прямоугольника цели в image (RGBA32), переиспользуя его буфер.
+    // Сначала дорисовывает накопленное. В режиме очереди кадр уже показан, и содержимое
+    // зависит от бэкенда - читайте без него
+    virtual bool readPixels(const IntRect &rect, Image &image);
+    bool readPixels(Image &image);
+    Image readPixels(const IntRect &rect);
+    Image readPixels();
+
+    // display() перед показом отдаёт кадр захвату (см. FrameCapture). Захват не владеется целью
+    // и должен быть отсоединён до разрушения; в режиме очереди кадры не захватываются
+    void setFrameCapture(FrameCapture *capture);
+    FrameCapture *getFrameCapture() const;
+
+    // display() в конце выдерживает период кадра (см. FrameLimiter); 0 - без ограничения.
+    // Статистика кадров копится всегда
+    void setFramerateLimit(double framerate);
+    const FrameLimiter &getFrameLimiter() const;
+    FrameLimiter &getFrameLimiter();
+
     std::shared_ptr<SDL_Renderer> getNativeSDLRenderer();
 
 protected:
     std::shared_ptr<SDL_Renderer> renderer_;
+    std::shared_ptr<std::recursive_mutex> rendererMtx_ = std::make_shared<std::recursive_mutex>();
+    // ID рендера в RendererRegistry: по нему текстуры находят свои копии в этом рендере
+    std::size_t rendererId_ = std::size_t(-1);
     View view_;
 
     unsigned viewId_ = 1;
 
 protected:
     void setBaseViewPosition(const Vector2f &pos);
+
+    void flushBatch();
+    void discardBatch();
+
+private:
+    // Подряд идущие вызовы drawShape с одной текстурой склеиваются в один SDL_RenderGeometryRaw
+    struct GeometryBatch
+    {
+        explicit GeometryBatch(std::pmr::memory_resource *resource)
+            : positions(resource), colors(resource), uv(resource), indices(resource)
+        {
+        }
+
+        SDL_Texture *texture = nullptr;
+        std::shared_ptr<SDL_Texture> textureRef; // держит texture живой до сброса пачки
+        std::pmr::vector<Vector2f> positions;
+        std::pmr::vector<SDL_FColor> colors;
+        std::pmr::vector<Vector2f> uv;
+        std::pmr::vector<int> indices;
+    };
+
+    FrameArena frameArena_;
+    GeometryBatch batch_{&frameArena_};
+
+    std::unique_ptr<detail::RenderQueue> queue_;
+
+    FrameCapture *capture_ = nullptr;
+    FrameLimiter frameLimiter_;
+
+private:
+    void rewindFrameArena();
+
+    void appendGeometry(const Texture *texture, int textureLevel,
+                        const Vector2f *positions, int posCnt,
+                        const Vector2f *uv, const Color *vertexColors, const Color &color,
+                        const int *indices, int indCnt);
+    void recordShape(const Texture *texture, int textureLevel, SDL_Texture *sdlTex,
+                     const Vector2f *positions, int posCnt,
+                     const Vector2f *uv,
+                     const Color *vertexColors, const SDL_FColor &color,
+                     const int *indices, int indCnt);
 };
 
 } // namespace sdl3
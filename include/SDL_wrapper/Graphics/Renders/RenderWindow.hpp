@@ -4,13 +4,20 @@
 
 #include "SDL3/SDL_events.h"
 #include "SDL3/SDL_video.h"
+#include <atomic>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string_view>
+#include <vector>
 
 #include <SDL3/SDL_render.h>
 
+#include <SDL_wrapper/Core/InputState.hpp>
+#include <SDL_wrapper/Core/Math/Matrix3x3.hpp>
+#include <SDL_wrapper/Core/MotionCoalescer.hpp>
 #include <SDL_wrapper/Core/Names.hpp>
+#include <SDL_wrapper/Core/TripleBuffer.hpp>
 #include <SDL_wrapper/Graphics/Renders/RenderTarget.hpp>
 #include <SDL_wrapper/Graphics/Renders/VideoMode.hpp>
 
@@ -33,11 +40,19 @@ public:
     bool isFullScreen() const;
     void setFullScreen(bool isFull);
 
+    // interval: 0 - выключено, 1 - каждое обновление экрана, 2 - через одно,
+    // SDL_RENDERER_VSYNC_ADAPTIVE - адаптивная. Неподдержанная адаптивная заменяется на 1
+    bool setVSync(int interval);
+    int getVSync() const;
+
     bool loadIconFromFile(std::string_view iconFileName);
     bool setLogicalPresentation(const Vector2i& size, const SDL_RendererLogicalPresentation mode);
 
     float getDisplayScale() const;
     float getPixelDensity() const;
+    // Плотность, по которой текстуры выбирают варианты name@Nx (масштаб дисплея окна).
+    // Обновляется в pollEvents при переходе окна на другой дисплей или смене масштаба
+    float getAssetDensity() const;
 
     Vector2i getSize() const;
     Vector2i getLogicSize() const;
@@ -46,6 +61,28 @@ public:
 
     void convertEventToRenderCoordinates(SDL_Event* event) const;
     void convertEventToViewCoordinates(SDL_Event* event) const;
+    void convertEventsToViewCoordinates(std::span<SDL_Event> events) const;
+
+    // Забирает все накопившиеся события пачками через SDL_PeepEvents и, если нужно, переводит
+    // события указателя этого окна в координаты вида. Буфер переиспользуется и действителен
+    // до следующего вызова.
+    std::span<SDL_Event> pollEvents(bool convertToView = true);
+
+    // Склейка движений мыши/пальцев/пера в pollEvents: одно событие на устройство между другими событиями
+    void setMotionCoalescing(bool enabled);
+    bool isMotionCoalescing() const;
+    // Настройка записи пути и доступ к промежуточным точкам последнего pollEvents
+    MotionCoalescer &getMotionCoalescer();
+    const MotionCoalescer &getMotionCoalescer() const;
+
+    // Снимок ввода, обновляемый каждым pollEvents (до склейки движений). В него идут только события
+    // этого окна и события без окна: клавиши и указатель других окон его не трогают
+    const InputState &getInputState() const;
+    // Включает публикацию снимков в тройной буфер для другого потока (например, симуляции):
+    // тот вызывает getInputSnapshots().acquire() и читает целый снимок без блокировок.
+    // Включать до запуска читающего потока
+    void setInputSnapshotPublishing(bool enabled);
+    TripleBuffer<InputState> &getInputSnapshots();
 
 private:
     
@@ -54,9 +91,30 @@ private:
 
     std::shared_ptr<SDL_Window> window_;
 
-    std::size_t windowID_ = std::size_t(-1);
+    std::shared_ptr<std::atomic<float>> density_ = std::make_shared<std::atomic<float>>(1.f);
+
+    std::vector<SDL_Event> eventBuffer_;
+    MotionCoalescer motionCoalescer_;
+    bool coalesceMotion_ = false;
+
+    InputState inputState_;
+    std::unique_ptr<TripleBuffer<InputState>> inputSnapshots_;
+    bool publishInput_ = false;
+
+    // Кэш обратной матрицы вида: действителен для пары (версия вида, центр цели)
+    mutable Matrix3x3<float> screenToView_;
+    mutable Vector2f inverseCenter_{};
+    mutable unsigned inverseViewId_ = 0;
+    mutable bool inverseValid_ = false;
 
 private:
+    const Matrix3x3<float> *getScreenToViewMatrix() const;
+
+    static void transformEventInPlace(SDL_Event &event, const Matrix3x3<float> &screenToView);
+    static SDL_WindowID getEventWindowID(const SDL_Event &event);
+
+    void updateDensity(std::span<const SDL_Event> events);
+
     void subscribe();
     void unsubscribe();
 };
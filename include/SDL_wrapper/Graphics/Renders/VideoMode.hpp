@@ -18,11 +18,16 @@ public:
     bool fullscreen = false;
     bool highDpi = false;
     bool vsync = true;
+    // При опоздании кадра показывать сразу, без ожидания следующего обновления экрана
+    // (late swap tearing); если драйвер не умеет, используется обычная синхронизация
+    bool adaptiveVsync = false;
 
 public:
     static VideoMode getDefaultVideoMode();
 
     static SDL_WindowFlags makeWindowFlags(const VideoMode &settings);
+    // Значение для SDL_SetRenderVSync
+    static int makeVSyncInterval(const VideoMode &settings);
 
 };
 
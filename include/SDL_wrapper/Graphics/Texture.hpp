@@ -4,36 +4,163 @@
 
 #include <cstddef>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include <SDL3/SDL_render.h>
 
 #include <SDL_wrapper/Core/Names.hpp>
+#include <SDL_wrapper/Graphics/Detail/TextureLifetime.hpp>
 
 namespace sdl3
 {
 
+class ThreadPool;
+
+namespace detail
+{
+class RendererRegistry;
+}
+
+// Невладеющая ссылка на SDL-текстуру для горячего пути отрисовки: чтение без атомиков и блокировок.
+// Владеет по-прежнему Texture; хэндл действителен, пока текстура не перезагружена и не уничтожена
+struct TextureHandle
+{
+    SDL_Texture *native = nullptr;
+};
+
+struct TextureLoadOptions
+{
+    // Цепочка уменьшенных вдвое копий до 1x1 для отрисовки в мелком масштабе
+    bool generateMipmaps = false;
+    // Пул для фильтрации и перевода формата уровней; без него всё считается в потоке загрузки.
+    // parallelFor пула обслуживает вызовы по одному: при загрузке не из потока рендера не передавайте
+    // пул, которым параллелится подготовка кадра, иначе кадр будет ждать фильтрации
+    ThreadPool *pool = nullptr;
+    // Перевести пиксели в предпочтительный формат рендера до выгрузки, чтобы ни выгрузка,
+    // ни программный рендер при каждой отрисовке не преобразовывали их сами
+    bool nativeFormat = false;
+    // Домножить цвет на альфу; текстура рисуется в режиме SDL_BLENDMODE_BLEND_PREMULTIPLIED
+    bool premultiplyAlpha = false;
+    // Искать рядом варианты name@2x.png, name@3x.png, ...: берётся наименьший не мельче плотности окна.
+    // Размеры текстуры тогда в логических единицах, и спрайты не зависят от выбранного варианта
+    bool densityVariants = false;
+    // Плотность для выбора варианта; 0 - плотность окна текстуры
+    float density = 0.f;
+};
+
 class SDL_WRAPPER_GRAPHICS_EXPORT Texture
 {
+    friend class detail::RendererRegistry;
+
 public:
-    explicit Texture(std::size_t windowID = 0);
+    // Окно по умолчанию: открытое окно с наименьшим слотом реестра на момент загрузки; при одном окне - оно.
+    // ID окон поколенческие, и окно, созданное после закрытия прежнего, получает новый ID, а не 0.
+    // При нескольких окнах или для RenderSurface передавайте window.getWindowID() / surface.getRendererID()
+    static constexpr std::size_t primaryWindow = std::size_t(-2);
+
+    explicit Texture(std::size_t windowID = primaryWindow);
 
     bool loadFromFile(const char *fileName);
+    bool loadFromFile(const char *fileName, const TextureLoadOptions &options);
+    // Декодирование, фильтрация и перевод формата в общих фоновых потоках (их число ограничено,
+    // options.pool не используется). Выгрузка - в finishLoading() из потока рендера:
+    // не все бэкенды допускают создание текстур из других потоков
+    void loadFromFileAsync(std::string fileName, const TextureLoadOptions &options = {});
+    bool isLoading() const;
+    bool isLoadReady() const;
+    // false, пока декодирование не завершено или если загрузка не удалась
+    bool finishLoading();
+    // Пиксели декодируются один раз и остаются в памяти; копия в каждом рендере создаётся при первой
+    // отрисовке в нём, и закрытие окна освобождает только копии его рендера. windowID задаёт только плотность вариантов
+    bool loadShared(const char *fileName, const TextureLoadOptions &options = {});
+    bool isShared() const;
+    // Перезагрузка, если плотности окна теперь подходит другой вариант name@Nx (окно перешло
+    // на другой дисплей). Вызывать после pollEvents; true, если текстура перезагружена
+    bool refreshDensityVariant();
     void clear();
 
     std::weak_ptr<const SDL_Texture> getSDLTexture() const;
     std::weak_ptr<SDL_Texture> getSDLTexture();
+    TextureHandle getHandle() const;
 
+    // Логический размер: пиксели, делённые на getScale()
     const Vector2i &getSize() const;
+    const Vector2i &getPixelSize() const;
+    // N выбранного варианта name@Nx; 1 для файла без суффикса
+    float getScale() const;
+    // Формат, в котором рендер хранит текстуру; SDL_PIXELFORMAT_UNKNOWN без текстуры
+    SDL_PixelFormat getFormat() const;
+    bool isPremultiplied() const;
+
+    // Уровни детализации: 0 - исходная текстура, без цепочки уровень один.
+    // Каждый уровень покрывает всё изображение, поэтому UV одни и те же для всех уровней
+    int getLevelCount() const;
+    int selectLevel(float texelScale) const;
+    TextureHandle getHandle(int level) const;
+    std::weak_ptr<const SDL_Texture> getSDLTexture(int level) const;
+    Vector2i getLevelSize(int level) const;
+
+    // Для общей текстуры - копия в рендере с данным ID реестра (выгружается при первом запросе),
+    // для обычной - то же, что getHandle(level). getSDLTexture не выгружает копию
+    TextureHandle getHandle(std::size_t rendererId, int level) const;
+    std::weak_ptr<const SDL_Texture> getSDLTexture(std::size_t rendererId, int level) const;
+
+    // Поколенческий ID этого объекта: после его разрушения ID больше не считается живым
+    std::size_t getLifetimeId() const;
 
 private:
+    struct MipLevel
+    {
+        std::shared_ptr<SDL_Texture> texture;
+        Vector2i size = {};
+    };
+
+    struct DecodedImage;
+    struct LoadJob;
+    struct RendererCopy;
+    struct SharedData;
 
     std::shared_ptr<SDL_Texture> texture_ = nullptr;
     Vector2i size_ = {};
+    SDL_PixelFormat format_ = SDL_PIXELFORMAT_UNKNOWN;
+    bool premultiplied_ = false;
+    Vector2i logicalSize_ = {};
+    float scale_ = 1.f;
+
+    // Что загружено, для повторного выбора варианта
+    std::string sourceName_;
+    std::string variantPath_;
+    TextureLoadOptions sourceOptions_;
+
+    std::vector<MipLevel> mips_;
+    std::shared_ptr<LoadJob> pending_;
+    // Общие пиксели и копии по рендерам; в mips_ тогда только размеры уровней
+    std::shared_ptr<SharedData> shared_;
 
     std::size_t windowID_ = std::size_t(-1);
+    detail::TextureLifetime lifetime_;
 
 private:
     void updateSize();
+    // windowID_ с подставленным primaryWindow
+    std::size_t resolveWindowID() const;
+    void updateLogicalSize();
+    float variantDensity(const TextureLoadOptions &options) const;
+    void rememberSource(std::string fileName, const TextureLoadOptions &options, std::string variantPath);
+    const MipLevel *findMip(int level) const;
+
+    // Без обращений к рендеру: безопасно в любом потоке
+    static DecodedImage decode(const char *fileName, const TextureLoadOptions &options,
+                               const std::vector<SDL_PixelFormat> &formats);
+    bool upload(const DecodedImage &decoded);
+    // Выгрузка всех уровней в один рендер под его мьютексом; при ошибке не создаётся ничего
+    const RendererCopy *uploadCopy(std::size_t rendererId) const;
+    // Вызывается реестром при отписке рендера
+    static void releaseRendererCopies(std::size_t rendererId) noexcept;
+    static bool createLevels(SDL_Renderer *renderer, const std::shared_ptr<std::recursive_mutex> &rendererMtx,
+                             const DecodedImage &decoded, std::vector<SDL_Texture *> &textures);
 };
 
 } // namespace sdl3
@@ -16,7 +16,12 @@ class SDL_WRAPPER_MIXER_EXPORT Audio
 {
     friend class AudioDevice;
 public:
-    explicit Audio(std::size_t deviceID = 0);
+    // Устройство по умолчанию: открытое устройство с наименьшим слотом реестра на момент загрузки;
+    // при одном устройстве - оно. ID устройств поколенческие, и устройство, открытое после закрытия
+    // прежнего, получает новый ID, а не 0. При нескольких устройствах передавайте device.getDeviceID()
+    static constexpr std::size_t primaryDevice = std::size_t(-2);
+
+    explicit Audio(std::size_t deviceID = primaryDevice);
     Audio(const Audio &other) = delete;
     Audio(Audio &&other) = default;
     Audio &operator=(const Audio &other) = delete;
@@ -2,11 +2,11 @@
 
 #include <cstddef>
 #include <memory>
-#include <mutex>
-#include <unordered_map>
 
 #include <SDL3_mixer/SDL_mixer.h>
 
+#include <SDL_wrapper/Core/Detail/SlotMap.hpp>
+
 namespace sdl3::mixer
 {
 class Audio;
@@ -22,24 +22,18 @@ class MixerRegistry
     friend class sdl3::mixer::AudioDevice;
 
 private:
-    struct Storage
-    {
-        std::unordered_map<std::size_t, std::weak_ptr<MIX_Mixer>> mixers;
-        std::size_t nextMixerId = 0;
-        std::size_t usersCount = 0;
-        std::mutex mtx;
-    };
-
-    inline static Storage* s_ = nullptr;
+    using Storage = sdl3::detail::SlotMap<std::weak_ptr<MIX_Mixer>>;
 
-    inline static constexpr std::size_t invalidID = std::size_t(-1);
+    inline static constexpr std::size_t invalidID = Storage::invalidId;
 
 private:
-    static Storage* storageOrNull_NoInit() noexcept;
+    static Storage &storage();
 
     static std::size_t subscribeMixer(std::shared_ptr<MIX_Mixer> mixer);
     static void unsubscribeMixer(std::size_t id) noexcept;
     static std::weak_ptr<MIX_Mixer> getMixer(std::size_t id) noexcept;
+    // Открытое устройство с наименьшим слотом; invalidID, если устройств нет
+    static std::size_t getPrimaryMixer();
 };
 
 } // namespace sdl3::mixer::detail
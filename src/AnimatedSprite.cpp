@@ -0,0 +1,269 @@
+#include <SDL_wrapper/Graphics/DrawTransformObjects/AnimatedSprite.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <SDL_wrapper/Graphics/Renders/RenderTarget.hpp>
+#include <SDL_wrapper/Graphics/Texture.hpp>
+
+namespace sdl3
+{
+
+AnimatedSprite::AnimatedSprite()
+{
+    clock_.pause(true);
+}
+
+void AnimatedSprite::setTexture(const Texture &texture)
+{
+    texture_ = &texture;
+    for (auto &frame : frames_)
+        updateFrameUV(frame);
+}
+
+const Texture *AnimatedSprite::getTexture() const
+{
+    return texture_;
+}
+
+void AnimatedSprite::setFilterColor(const Color &color)
+{
+    color_ = color;
+}
+
+const Color &AnimatedSprite::getFilterColor() const
+{
+    return color_;
+}
+
+void AnimatedSprite::addFrame(const FloatRect &rect, const float durationS)
+{
+    Frame frame;
+    frame.rect = rect;
+    const auto duration = static_cast<std::uint64_t>(std::llround(std::max(durationS, 0.f) * 1e9));
+    frame.endNS = (frames_.empty() ? 0 : frames_.back().endNS) + duration;
+    updateFrameUV(frame);
+    frames_.push_back(frame);
+
+    if (frames_.size() == 1)
+        updateLocalVertices();
+}
+
+void AnimatedSprite::addFrameGrid(const Vector2i &frameSize, const std::size_t frameCount, const float frameDurationS, const Vector2i &start)
+{
+    if (frameSize.x <= 0 || frameSize.y <= 0)
+        return;
+
+    const int sheetWidth = texture_ ? texture_->getSize().x : 0;
+    Vector2i pos = start;
+    frames_.reserve(frames_.size() + frameCount);
+    for (std::size_t i = 0; i < frameCount; ++i)
+    {
+        if (sheetWidth > 0 && pos.x + frameSize.x > sheetWidth)
+        {
+            pos.x = 0;
+            pos.y += frameSize.y;
+        }
+        addFrame({static_cast<float>(pos.x), static_cast<float>(pos.y),
+                  static_cast<float>(frameSize.x), static_cast<float>(frameSize.y)},
+                 frameDurationS);
+        pos.x += frameSize.x;
+    }
+}
+
+void AnimatedSprite::clearFrames()
+{
+    frames_.clear();
+    current_ = 0;
+    updateLocalVertices();
+}
+
+std::size_t AnimatedSprite::getFrameCount() const
+{
+    return frames_.size();
+}
+
+void AnimatedSprite::setFrame(const std::size_t index)
+{
+    if (index >= frames_.size() || index == current_)
+        return;
+
+    const FloatRect &oldRect = frames_[current_].rect;
+    const FloatRect &newRect = frames_[index].rect;
+    current_ = index;
+
+    // Кадры одного размера отличаются только UV: вершины остаются прежними
+    if (oldRect.w != newRect.w || oldRect.h != newRect.h)
+        updateLocalVertices();
+}
+
+std::size_t AnimatedSprite::getFrame() const
+{
+    return current_;
+}
+
+void AnimatedSprite::play()
+{
+    playing_ = true;
+    // Доигравшая неповторяемая анимация начинается заново, а не встаёт сразу на последний кадр
+    if (!looped_ && !frames_.empty() && clock_.elapsedTimeNS() >= frames_.back().endNS)
+    {
+        clock_.start();
+        setFrame(0);
+        return;
+    }
+    clock_.pause(false);
+}
+
+void AnimatedSprite::pause()
+{
+    playing_ = false;
+    clock_.pause(true);
+}
+
+void AnimatedSprite::stop()
+{
+    pause();
+    clock_.start();
+    clock_.pause(true);
+    setFrame(0);
+}
+
+bool AnimatedSprite::isPlaying() const
+{
+    return playing_;
+}
+
+void AnimatedSprite::setLooped(const bool looped)
+{
+    looped_ = looped;
+}
+
+bool AnimatedSprite::isLooped() const
+{
+    return looped_;
+}
+
+void AnimatedSprite::update()
+{
+    if (!playing_ || frames_.empty())
+        return;
+
+    const std::uint64_t total = frames_.back().endNS;
+    if (total == 0)
+        return;
+
+    std::uint64_t time = clock_.elapsedTimeNS();
+    if (time >= total)
+    {
+        if (!looped_)
+        {
+            pause();
+            setFrame(frames_.size() - 1);
+            return;
+        }
+        time %= total;
+    }
+
+    const auto it = std::upper_bound(frames_.begin(), frames_.end(), time, [](const std::uint64_t t, const Frame &frame)
+    {
+        return t < frame.endNS;
+    });
+    setFrame(static_cast<std::size_t>(it - frames_.begin()));
+}
+
+void AnimatedSprite::draw(RenderTarget &target) const
+{
+    if (!texture_ || frames_.empty())
+        return;
+
+    if (viewID_ != target.getViewId() || isGeometryDirty() || dirty_)
+        prepare(target.getRenderContext());
+    target.drawShape(texture_, vertices_, 4, frames_[current_].uv, 4, color_, indices_, 6, textureLevel_);
+}
+
+void AnimatedSprite::prepare(const RenderContext &context) const
+{
+    if (!texture_ || frames_.empty())
+        return;
+
+    if (viewID_ != context.viewId || isGeometryDirty() || dirty_)
+    {
+        const Matrix3x3<float> matrix = context.viewMatrix * getTransformMatrix();
+        for (int i = 0; i < 4; ++i)
+            vertices_[i] = matrix.transform(localVertices_[i]);
+        textureLevel_ = texture_->getLevelCount() > 1
+                            ? texture_->selectLevel(std::sqrt(std::abs(matrix.determinant())))
+                            : 0;
+        dirty_ = false;
+        viewID_ = context.viewId;
+        updateGeometryVersion();
+    }
+}
+
+void AnimatedSprite::updateFrameUV(Frame &frame) const
+{
+    if (!texture_)
+    {
+        for (auto &p : frame.uv)
+            p = {0.f, 0.f};
+        return;
+    }
+
+    const Vector2i texSize = texture_->getSize();
+    const float tw = static_cast<float>(texSize.x);
+    const float th = static_cast<float>(texSize.y);
+
+    const float u1 = frame.rect.x / tw;
+    const float v1 = frame.rect.y / th;
+    const float u2 = (frame.rect.x + frame.rect.w) / tw;
+    const float v2 = (frame.rect.y + frame.rect.h) / th;
+
+    frame.uv[0] = {u1, v1};
+    frame.uv[1] = {u2, v1};
+    frame.uv[2] = {u2, v2};
+    frame.uv[3] = {u1, v2};
+}
+
+FloatRect AnimatedSprite::getLocalBounds() const
+{
+    return {0.f, 0.f, localVertices_[2].x, localVertices_[2].y};
+}
+
+FloatRect AnimatedSprite::getGlobalBounds() const
+{
+    return getTransformMatrix().transformRect(getLocalBounds());
+}
+
+bool AnimatedSprite::containsPoint(const Vector2f &point) const
+{
+    if (!texture_ || frames_.empty())
+        return false;
+
+    Matrix3x3<float> inverse;
+    if (!getTransformMatrix().tryInverse(inverse))
+        return false;
+
+    const Vector2f local = inverse.transform(point);
+    return local.x >= 0.f && local.x <= localVertices_[2].x && local.y >= 0.f && local.y <= localVertices_[2].y;
+}
+
+unsigned AnimatedSprite::getPickVersion() const
+{
+    return getVersion() + localVersion_;
+}
+
+void AnimatedSprite::updateLocalVertices()
+{
+    ++localVersion_;
+    const float w = frames_.empty() ? 0.f : frames_[current_].rect.w;
+    const float h = frames_.empty() ? 0.f : frames_[current_].rect.h;
+
+    localVertices_[0] = {0.f, 0.f};
+    localVertices_[1] = {w, 0.f};
+    localVertices_[2] = {w, h};
+    localVertices_[3] = {0.f, h};
+    dirty_ = true;
+}
+
+} // namespace sdl3
@@ -18,7 +18,8 @@ void Audio::stop()
 
 bool Audio::loadFromFile(const char *path, bool predecode)
 {
-    std::shared_ptr<MIX_Mixer> mixerS = detail::MixerRegistry::getMixer(deviceID_).lock();
+    const std::size_t deviceID = deviceID_ == primaryDevice ? detail::MixerRegistry::getPrimaryMixer() : deviceID_;
+    std::shared_ptr<MIX_Mixer> mixerS = detail::MixerRegistry::getMixer(deviceID).lock();
     if (!mixerS)
     {
         SDL_Log("There is no mixer to load the audio");
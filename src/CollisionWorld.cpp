@@ -0,0 +1,306 @@
+#include <SDL_wrapper/Graphics/CollisionWorld.hpp>
+
+#include <algorithm>
+
+#include <SDL_wrapper/Core/Math/Intersection.hpp>
+#include <SDL_wrapper/Graphics/DrawTransformObjects/AnimatedSprite.hpp>
+#include <SDL_wrapper/Graphics/DrawTransformObjects/Sprite.hpp>
+#include <SDL_wrapper/Graphics/ObjectBase/Shape.hpp>
+
+namespace sdl3
+{
+
+CollisionWorld::Id CollisionWorld::insert(const Shape &shape)
+{
+    return insertBody(shape, Kind::Shape);
+}
+
+CollisionWorld::Id CollisionWorld::insert(const Sprite &sprite)
+{
+    return insertBody(sprite, Kind::Sprite);
+}
+
+CollisionWorld::Id CollisionWorld::insert(const AnimatedSprite &sprite)
+{
+    return insertBody(sprite, Kind::AnimatedSprite);
+}
+
+bool CollisionWorld::remove(const Id id)
+{
+    if (id >= bodies_.size() || !bodies_[id].object)
+        return false;
+
+    bodies_[id] = Body{};
+    freeIds_.push_back(id);
+    --liveCount_;
+    endpointsDirty_ = true;
+    return true;
+}
+
+void CollisionWorld::clear()
+{
+    bodies_.clear();
+    freeIds_.clear();
+    endpoints_.clear();
+    active_.clear();
+    activeSlot_.clear();
+    broadPairs_.clear();
+    collisions_.clear();
+    liveCount_ = 0;
+    endpointsDirty_ = false;
+}
+
+std::size_t CollisionWorld::getSize() const
+{
+    return liveCount_;
+}
+
+const Pickable *CollisionWorld::getObject(const Id id) const
+{
+    return id < bodies_.size() ? bodies_[id].object : nullptr;
+}
+
+void CollisionWorld::update()
+{
+    for (Body &body : bodies_)
+    {
+        if (!body.object)
+            continue;
+        const unsigned version = body.object->getPickVersion();
+        if (version == body.version)
+            continue;
+        body.version = version;
+        body.box = toBox(body.object->getGlobalBounds());
+    }
+
+    if (endpointsDirty_)
+        rebuildEndpoints();
+    else
+        sortEndpoints();
+
+    sweep();
+
+    collisions_.clear();
+    for (const Pair &pair : broadPairs_)
+        if (testBodies(pair.first, pair.second))
+            collisions_.push_back(pair);
+}
+
+std::span<const CollisionWorld::Pair> CollisionWorld::getBroadPhasePairs() const
+{
+    return broadPairs_;
+}
+
+std::span<const CollisionWorld::Pair> CollisionWorld::getCollisions() const
+{
+    return collisions_;
+}
+
+bool CollisionWorld::testCollision(const Id first, const Id second)
+{
+    if (first >= bodies_.size() || second >= bodies_.size() || first == second)
+        return false;
+    if (!bodies_[first].object || !bodies_[second].object)
+        return false;
+    return testBodies(first, second);
+}
+
+CollisionWorld::Id CollisionWorld::insertBody(const Pickable &object, const Kind kind)
+{
+    Id id = bodies_.size();
+    if (!freeIds_.empty())
+    {
+        id = freeIds_.back();
+        freeIds_.pop_back();
+    }
+    else
+        bodies_.emplace_back();
+
+    Body &body = bodies_[id];
+    body.object = &object;
+    body.kind = kind;
+    body.version = object.getPickVersion();
+    body.box = toBox(object.getGlobalBounds());
+
+    ++liveCount_;
+    endpointsDirty_ = true;
+    return id;
+}
+
+CollisionWorld::Box CollisionWorld::toBox(const FloatRect &rect)
+{
+    return {std::min(rect.x, rect.x + rect.w), std::min(rect.y, rect.y + rect.h),
+            std::max(rect.x, rect.x + rect.w), std::max(rect.y, rect.y + rect.h)};
+}
+
+bool CollisionWorld::endpointLess(const Endpoint &a, const Endpoint &b)
+{
+    // При равенстве начало идёт раньше конца: касающиеся рамки дают пару
+    if (a.value != b.value)
+        return a.value < b.value;
+    return !a.isMax && b.isMax;
+}
+
+void CollisionWorld::rebuildEndpoints()
+{
+    endpointsDirty_ = false;
+
+    endpoints_.clear();
+    endpoints_.reserve(liveCount_ * 2);
+    for (std::size_t i = 0; i < bodies_.size(); ++i)
+    {
+        const Body &body = bodies_[i];
+        if (!body.object)
+            continue;
+        endpoints_.push_back({body.box.minX, static_cast<std::uint32_t>(i), false});
+        endpoints_.push_back({body.box.maxX, static_cast<std::uint32_t>(i), true});
+    }
+    std::sort(endpoints_.begin(), endpoints_.end(), &CollisionWorld::endpointLess);
+}
+
+void CollisionWorld::sortEndpoints()
+{
+    for (Endpoint &endpoint : endpoints_)
+    {
+        const Box &box = bodies_[endpoint.body].box;
+        endpoint.value = endpoint.isMax ? box.maxX : box.minX;
+    }
+
+    // Между тиками порядок почти не меняется, и вставками выходит близко к O(n).
+    // Если объекты разом перемешались, дорогие вставки прерываются полной сортировкой
+    const std::size_t shiftLimit = endpoints_.size() * 32;
+    std::size_t shifts = 0;
+    for (std::size_t i = 1; i < endpoints_.size(); ++i)
+    {
+        const Endpoint endpoint = endpoints_[i];
+        std::size_t j = i;
+        while (j > 0 && endpointLess(endpoint, endpoints_[j - 1]))
+        {
+            endpoints_[j] = endpoints_[j - 1];
+            --j;
+        }
+        endpoints_[j] = endpoint;
+
+        shifts += i - j;
+        if (shifts > shiftLimit)
+        {
+            std::sort(endpoints_.begin(), endpoints_.end(), &CollisionWorld::endpointLess);
+            return;
+        }
+    }
+}
+
+void CollisionWorld::sweep()
+{
+    broadPairs_.clear();
+    active_.clear();
+    activeSlot_.resize(bodies_.size());
+
+    for (const Endpoint &endpoint : endpoints_)
+    {
+        const std::uint32_t index = endpoint.body;
+        if (endpoint.isMax)
+        {
+            // Удаление перестановкой с последним: порядок активных не важен
+            const std::uint32_t slot = activeSlot_[index];
+            active_[slot] = active_.back();
+            activeSlot_[active_[slot].body] = slot;
+            active_.pop_back();
+            continue;
+        }
+
+        const Box &box = bodies_[index].box;
+        for (const ActiveEntry &other : active_)
+            if (box.minY <= other.maxY && other.minY <= box.maxY)
+                broadPairs_.push_back({std::min<Id>(index, other.body), std::max<Id>(index, other.body)});
+
+        activeSlot_[index] = static_cast<std::uint32_t>(active_.size());
+        active_.push_back({index, box.minY, box.maxY});
+    }
+}
+
+const CollisionWorld::Body *CollisionWorld::prepareWorld(const Id id)
+{
+    Body &body = bodies_[id];
+    const unsigned version = body.object->getPickVersion();
+    if (body.worldValid && body.worldVersion == version)
+        return &body;
+
+    body.world.clear();
+    if (body.kind == Kind::Shape)
+    {
+        const auto &shape = static_cast<const Shape &>(*body.object);
+        if (shape.mesh_)
+        {
+            const Matrix3x3<float> &matrix = shape.getTransformMatrix();
+            body.world.reserve(shape.mesh_->vertices.size());
+            for (const Vector2f &vertex : shape.mesh_->vertices)
+                body.world.push_back(matrix.transform(vertex));
+        }
+    }
+    else
+    {
+        const FloatRect local = body.kind == Kind::Sprite
+                                    ? static_cast<const Sprite &>(*body.object).getLocalBounds()
+                                    : static_cast<const AnimatedSprite &>(*body.object).getLocalBounds();
+        const Matrix3x3<float> &matrix = body.kind == Kind::Sprite
+                                             ? static_cast<const Sprite &>(*body.object).getTransformMatrix()
+                                             : static_cast<const AnimatedSprite &>(*body.object).getTransformMatrix();
+        body.world.push_back(matrix.transform({local.x, local.y}));
+        body.world.push_back(matrix.transform({local.x + local.w, local.y}));
+        body.world.push_back(matrix.transform({local.x + local.w, local.y + local.h}));
+        body.world.push_back(matrix.transform({local.x, local.y + local.h}));
+    }
+
+    body.worldVersion = version;
+    body.worldValid = true;
+    return &body;
+}
+
+void CollisionWorld::appendTriangle(const Body &body, const std::vector<int> &indices, const std::size_t first, Vector2f (&out)[3])
+{
+    for (std::size_t k = 0; k < 3; ++k)
+        out[k] = body.world[static_cast<std::size_t>(indices[first + k])];
+}
+
+bool CollisionWorld::testBodies(const Id first, const Id second)
+{
+    const Body &a = *prepareWorld(first);
+    const Body &b = *prepareWorld(second);
+
+    // Невыпуклая фигура раскладывается на треугольники своей сетки, выпуклая и спрайт - одна часть
+    auto concaveIndices = [](const Body &body) -> const std::vector<int> *
+    {
+        if (body.kind != Kind::Shape)
+            return nullptr;
+        const auto &mesh = static_cast<const Shape &>(*body.object).mesh_;
+        return mesh && !mesh->convex ? mesh->indices.get() : nullptr;
+    };
+
+    const std::vector<int> *indicesA = concaveIndices(a);
+    const std::vector<int> *indicesB = concaveIndices(b);
+
+    if (!indicesA && !indicesB)
+        return intersectConvexPolygons(a.world, b.world);
+
+    auto forEachPart = [](const Body &body, const std::vector<int> *indices, auto &&fn) -> bool
+    {
+        if (!indices)
+            return fn(std::span<const Vector2f>(body.world.data(), body.world.size()));
+
+        Vector2f triangle[3];
+        for (std::size_t i = 0; i + 2 < indices->size(); i += 3)
+        {
+            appendTriangle(body, *indices, i, triangle);
+            if (fn(std::span<const Vector2f>(triangle)))
+                return true;
+        }
+        return false;
+    };
+
+    return forEachPart(a, indicesA, [&](const std::span<const Vector2f> partA)
+                       { return forEachPart(b, indicesB, [&](const std::span<const Vector2f> partB)
+                                            { return intersectConvexPolygons(partA, partB); }); });
+}
+
+} // namespace sdl3
@@ -0,0 +1,68 @@
+#include <SDL_wrapper/Core/EventBus.hpp>
+
+#include <SDL3/SDL_log.h>
+
+namespace sdl3
+{
+
+EventBus::EventBus(const std::size_t defaultCapacity)
+    : defaultCapacity_(defaultCapacity)
+{
+}
+
+EventBus::~EventBus()
+{
+    for (auto &channel : channels_)
+        delete channel.load(std::memory_order_acquire);
+}
+
+bool EventBus::unsubscribe(const SubscriptionId id)
+{
+    for (auto &slot : channels_)
+    {
+        ChannelBase *channel = slot.load(std::memory_order_acquire);
+        if (channel && channel->unsubscribe(id))
+        {
+            if (!dispatching_)
+                channel->flushPending();
+            return true;
+        }
+    }
+    return false;
+}
+
+std::size_t EventBus::dispatch()
+{
+    // Вложенный вызов из обработчика забрал бы событие, которое внешний ещё раздаёт,
+    // и сдвинул бы векторы обработчиков под обходом. Новые события раздаст внешний вызов
+    if (dispatching_)
+    {
+        SDL_Log("EventBus: nested dispatch() from a handler is ignored");
+        return 0;
+    }
+    dispatching_ = true;
+
+    std::size_t count = 0;
+    for (auto &slot : channels_)
+        if (ChannelBase *channel = slot.load(std::memory_order_acquire))
+            count += channel->drain();
+
+    dispatching_ = false;
+
+    for (auto &slot : channels_)
+        if (ChannelBase *channel = slot.load(std::memory_order_acquire))
+            channel->flushPending();
+
+    return count;
+}
+
+std::size_t EventBus::nextTypeIndex()
+{
+    static std::atomic<std::size_t> counter = 0;
+    const std::size_t index = counter.fetch_add(1, std::memory_order_relaxed);
+    if (index >= maxEventTypes)
+        SDL_Log("EventBus: too many event types (max %zu)", maxEventTypes);
+    return index;
+}
+
+} // namespace sdl3
@@ -0,0 +1,106 @@
+#include <SDL_wrapper/Core/FrameArena.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace
+{
+
+constexpr std::size_t blockAlignment = alignof(std::max_align_t);
+
+} // namespace
+
+namespace sdl3
+{
+
+FrameArena::FrameArena(const std::size_t initialCapacity)
+{
+    if (initialCapacity != 0)
+        blocks_.push_back(allocateBlock(initialCapacity));
+}
+
+FrameArena::~FrameArena()
+{
+    for (const Block &block : blocks_)
+        freeBlock(block);
+}
+
+void FrameArena::reset()
+{
+    if (blocks_.size() > 1)
+    {
+        // Кадр не уместился в один блок: заменяем всё одним блоком на весь объём
+        std::size_t total = 0;
+        for (const Block &block : blocks_)
+        {
+            total += block.size;
+            freeBlock(block);
+        }
+        blocks_.clear();
+        blocks_.push_back(allocateBlock(total));
+    }
+    current_ = 0;
+    offset_ = 0;
+    usedBefore_ = 0;
+}
+
+std::size_t FrameArena::getUsedBytes() const
+{
+    return usedBefore_ + offset_;
+}
+
+std::size_t FrameArena::getCapacity() const
+{
+    std::size_t total = 0;
+    for (const Block &block : blocks_)
+        total += block.size;
+    return total;
+}
+
+void *FrameArena::do_allocate(const std::size_t bytes, const std::size_t alignment)
+{
+    while (current_ < blocks_.size())
+    {
+        const Block &block = blocks_[current_];
+        const auto base = reinterpret_cast<std::uintptr_t>(block.data);
+        const std::uintptr_t aligned = (base + offset_ + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+        const std::size_t end = static_cast<std::size_t>(aligned - base) + bytes;
+        if (end <= block.size)
+        {
+            offset_ = end;
+            return reinterpret_cast<void *>(aligned);
+        }
+
+        usedBefore_ += offset_;
+        offset_ = 0;
+        ++current_;
+    }
+
+    const std::size_t last = blocks_.empty() ? 0 : blocks_.back().size;
+    blocks_.push_back(allocateBlock(std::max(last * 2, bytes + alignment)));
+    return do_allocate(bytes, alignment);
+}
+
+void FrameArena::do_deallocate(void * /*p*/, std::size_t /*bytes*/, std::size_t /*alignment*/)
+{
+}
+
+bool FrameArena::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+    return this == &other;
+}
+
+FrameArena::Block FrameArena::allocateBlock(const std::size_t size)
+{
+    Block block;
+    block.data = static_cast<std::byte *>(::operator new(size, std::align_val_t{blockAlignment}));
+    block.size = size;
+    return block;
+}
+
+void FrameArena::freeBlock(const Block &block) noexcept
+{
+    ::operator delete(block.data, std::align_val_t{blockAlignment});
+}
+
+} // namespace sdl3
@@ -0,0 +1,249 @@
+#include <SDL_wrapper/Graphics/Renders/FrameCapture.hpp>
+
+#include <cstdio>
+#include <string_view>
+#include <utility>
+
+#include <SDL3/SDL_log.h>
+
+#include <SDL_wrapper/Graphics/Renders/RenderTarget.hpp>
+
+namespace
+{
+
+// BT.601, ограниченный диапазон, целочисленно с округлением
+inline std::uint8_t toY(const int r, const int g, const int b)
+{
+    return static_cast<std::uint8_t>(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+}
+
+inline std::uint8_t toU(const int r, const int g, const int b)
+{
+    return static_cast<std::uint8_t>(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+}
+
+inline std::uint8_t toV(const int r, const int g, const int b)
+{
+    return static_cast<std::uint8_t>(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+}
+
+} // namespace
+
+namespace sdl3
+{
+
+FrameCapture::FrameCapture(const std::size_t bufferCount)
+    : buffers_(bufferCount > 0 ? bufferCount : 1)
+{
+    freeBuffers_.reserve(buffers_.size());
+    for (std::size_t i = buffers_.size(); i > 0; --i)
+        freeBuffers_.push_back(i - 1);
+    worker_ = std::thread(&FrameCapture::workerLoop, this);
+}
+
+FrameCapture::~FrameCapture()
+{
+    closeStream();
+    flush();
+    {
+        std::lock_guard lk(mtx_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    worker_.join();
+}
+
+bool FrameCapture::openStream(const std::string &fileName, const CaptureFormat format, const int fps)
+{
+    closeStream();
+
+    // Очередь пуста: поток записи файл не трогает
+    stream_.close();
+    if (!stream_.open(std::string_view(fileName), FileWorkerMode::write | FileWorkerMode::binary))
+    {
+        SDL_Log("FrameCapture: can't open %s", fileName.c_str());
+        return false;
+    }
+    format_ = format;
+    fps_ = fps > 0 ? fps : 60;
+    streamSize_ = {};
+    headerWritten_ = false;
+    streaming_ = true;
+    return true;
+}
+
+void FrameCapture::closeStream()
+{
+    if (!streaming_)
+        return;
+    streaming_ = false;
+    flush();
+    stream_.close();
+}
+
+bool FrameCapture::isStreaming() const
+{
+    return streaming_;
+}
+
+void FrameCapture::requestScreenshot(std::string fileName)
+{
+    pendingScreenshots_.push_back(std::move(fileName));
+}
+
+void FrameCapture::flush()
+{
+    std::unique_lock lk(mtx_);
+    idle_.wait(lk, [this] { return jobs_.empty() && !busy_; });
+}
+
+bool FrameCapture::wantsFrame() const
+{
+    return streaming_ || !pendingScreenshots_.empty();
+}
+
+void FrameCapture::captureFrame(RenderTarget &target)
+{
+    if (!wantsFrame())
+        return;
+
+    std::size_t buffer = 0;
+    {
+        std::lock_guard lk(mtx_);
+        if (freeBuffers_.empty())
+        {
+            // Запись отстаёт: теряем кадр, но не тормозим показ. Снимки ждут следующего кадра
+            ++dropped_;
+            return;
+        }
+        buffer = freeBuffers_.back();
+        freeBuffers_.pop_back();
+    }
+
+    // Буфер принадлежит только этому вызову, пока задание не поставлено в очередь
+    if (!target.readPixels(buffers_[buffer]))
+    {
+        std::lock_guard lk(mtx_);
+        freeBuffers_.push_back(buffer);
+        ++dropped_;
+        return;
+    }
+
+    Job job;
+    job.buffer = buffer;
+    job.screenshots = std::move(pendingScreenshots_);
+    job.toStream = streaming_;
+    pendingScreenshots_.clear();
+    {
+        std::lock_guard lk(mtx_);
+        jobs_.push_back(std::move(job));
+        ++captured_;
+    }
+    wake_.notify_one();
+}
+
+std::uint64_t FrameCapture::getCapturedFrames() const
+{
+    std::lock_guard lk(mtx_);
+    return captured_;
+}
+
+std::uint64_t FrameCapture::getDroppedFrames() const
+{
+    std::lock_guard lk(mtx_);
+    return dropped_;
+}
+
+void FrameCapture::workerLoop()
+{
+    std::unique_lock lk(mtx_);
+    while (true)
+    {
+        wake_.wait(lk, [this] { return stop_ || !jobs_.empty(); });
+        if (jobs_.empty())
+            return;
+
+        Job job = std::move(jobs_.front());
+        jobs_.pop_front();
+        busy_ = true;
+
+        lk.unlock();
+        writeJob(job);
+        lk.lock();
+
+        freeBuffers_.push_back(job.buffer);
+        busy_ = false;
+        if (jobs_.empty())
+            idle_.notify_all();
+    }
+}
+
+void FrameCapture::writeJob(const Job &job)
+{
+    const Image &image = buffers_[job.buffer];
+    for (const std::string &name : job.screenshots)
+        if (!image.saveToFile(name.c_str()))
+            SDL_Log("FrameCapture: can't save %s", name.c_str());
+
+    if (job.toStream)
+        writeStreamFrame(image);
+}
+
+void FrameCapture::writeStreamFrame(const Image &image)
+{
+    if (!stream_.isOpen())
+        return;
+
+    if (!headerWritten_)
+    {
+        streamSize_ = image.getSize();
+        if (format_ == CaptureFormat::Y4m)
+        {
+            char header[96];
+            const int len = std::snprintf(header, sizeof(header), "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C444\n",
+                                          streamSize_.x, streamSize_.y, fps_);
+            stream_.write(std::string_view(header, static_cast<std::size_t>(len)));
+        }
+        headerWritten_ = true;
+    }
+    // Окно изменило размер: в потоке фиксированного размера такой кадр не поместится
+    if (image.getSize() != streamSize_)
+        return;
+
+    if (format_ == CaptureFormat::Y4m)
+    {
+        encodeY4m(image);
+        stream_.write(encodeBuffer_);
+    }
+    else
+    {
+        const std::size_t bytes = image.getPitch() * static_cast<std::size_t>(image.getSize().y);
+        stream_.write(std::string_view(reinterpret_cast<const char *>(image.getPixels()), bytes));
+    }
+}
+
+void FrameCapture::encodeY4m(const Image &image)
+{
+    static constexpr std::string_view frameTag = "FRAME\n";
+
+    const std::size_t planeSize = static_cast<std::size_t>(image.getSize().x) * static_cast<std::size_t>(image.getSize().y);
+    encodeBuffer_.resize(frameTag.size() + planeSize * 3);
+    encodeBuffer_.replace(0, frameTag.size(), frameTag);
+
+    auto *y = reinterpret_cast<std::uint8_t *>(encodeBuffer_.data() + frameTag.size());
+    std::uint8_t *u = y + planeSize;
+    std::uint8_t *v = u + planeSize;
+
+    const std::uint8_t *src = image.getPixels();
+    for (std::size_t i = 0; i < planeSize; ++i, src += Image::bytesPerPixel)
+    {
+        const int r = src[0];
+        const int g = src[1];
+        const int b = src[2];
+        y[i] = toY(r, g, b);
+        u[i] = toU(r, g, b);
+        v[i] = toV(r, g, b);
+    }
+}
+
+} // namespace sdl3
@@ -0,0 +1,118 @@
+#include <SDL_wrapper/Core/FrameLimiter.hpp>
+
+#include <algorithm>
+#include <thread>
+
+#include <SDL3/SDL_timer.h>
+
+namespace
+{
+
+constexpr std::uint64_t minSpinThresholdNS = 200'000;
+constexpr std::uint64_t maxSpinThresholdNS = 4'000'000;
+
+} // namespace
+
+namespace sdl3
+{
+
+FrameLimiter::FrameLimiter(const double framerate)
+{
+    setFramerateLimit(framerate);
+}
+
+void FrameLimiter::setFramerateLimit(const double framerate)
+{
+    periodNS_ = framerate > 0.0 ? static_cast<std::uint64_t>(1e9 / framerate + 0.5) : 0;
+    reset();
+}
+
+double FrameLimiter::getFramerateLimit() const
+{
+    return periodNS_ ? 1e9 / static_cast<double>(periodNS_) : 0.0;
+}
+
+std::uint64_t FrameLimiter::wait()
+{
+    if (periodNS_)
+    {
+        const std::uint64_t now = clock_.elapsedTimeNS();
+        if (now > deadlineNS_ + periodNS_)
+        {
+            // Отстали больше чем на кадр: догонять пачкой кадров без ожидания незачем
+            deadlineNS_ = now;
+            ++stats_.missed;
+        }
+        else
+        {
+            if (now > deadlineNS_)
+                ++stats_.missed;
+            sleepUntil(deadlineNS_);
+        }
+        deadlineNS_ += periodNS_;
+    }
+
+    const std::uint64_t end = clock_.elapsedTimeNS();
+    const std::uint64_t frameNS = end - frameStartNS_;
+    frameStartNS_ = end;
+    recordFrame(frameNS);
+    return frameNS;
+}
+
+void FrameLimiter::reset()
+{
+    clock_.start();
+    frameStartNS_ = 0;
+    deadlineNS_ = periodNS_;
+}
+
+const FrameStats &FrameLimiter::getStats() const
+{
+    return stats_;
+}
+
+void FrameLimiter::resetStats()
+{
+    stats_ = {};
+    totalNS_ = 0.0;
+}
+
+void FrameLimiter::sleepUntil(const std::uint64_t deadlineNS)
+{
+    std::uint64_t now = clock_.elapsedTimeNS();
+    if (now + spinThresholdNS_ < deadlineNS)
+    {
+        const std::uint64_t requested = deadlineNS - now - spinThresholdNS_;
+        SDL_DelayNS(requested);
+        const std::uint64_t slept = clock_.elapsedTimeNS() - now;
+
+        // Порог следует за пересыпанием: быстро растёт после плохого сна, медленно снижается
+        const std::uint64_t oversleep = slept > requested ? slept - requested : 0;
+        const std::uint64_t target = oversleep + oversleep / 2;
+        if (target > spinThresholdNS_)
+            spinThresholdNS_ = target;
+        else
+            spinThresholdNS_ -= (spinThresholdNS_ - target) / 16;
+        spinThresholdNS_ = std::clamp(spinThresholdNS_, minSpinThresholdNS, maxSpinThresholdNS);
+    }
+
+    while (clock_.elapsedTimeNS() < deadlineNS)
+        std::this_thread::yield();
+}
+
+void FrameLimiter::recordFrame(const std::uint64_t frameNS)
+{
+    stats_.lastNS = frameNS;
+    if (stats_.frames == 0)
+        stats_.minNS = stats_.maxNS = frameNS;
+    else
+    {
+        stats_.minNS = std::min(stats_.minNS, frameNS);
+        stats_.maxNS = std::max(stats_.maxNS, frameNS);
+    }
+    ++stats_.frames;
+    totalNS_ += static_cast<double>(frameNS);
+    stats_.averageNS = totalNS_ / static_cast<double>(stats_.frames);
+}
+
+} // namespace sdl3
@@ -0,0 +1,142 @@
+#include <SDL_wrapper/Graphics/Image.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_log.h>
+#include <SDL3/SDL_surface.h>
+#include <SDL3_image/SDL_image.h>
+
+namespace
+{
+
+std::uint8_t toByte(const float value)
+{
+    return static_cast<std::uint8_t>(std::clamp(value, 0.f, 1.f) * 255.f + 0.5f);
+}
+
+bool hasPngExtension(const std::string_view name)
+{
+    if (name.size() < 4)
+        return false;
+    const std::string_view ext = name.substr(name.size() - 4);
+    return ext == ".png" || ext == ".PNG";
+}
+
+} // namespace
+
+namespace sdl3
+{
+
+void Image::create(const Vector2i &size, const Color &color)
+{
+    size_ = {std::max(size.x, 0), std::max(size.y, 0)};
+    pixels_.resize(static_cast<std::size_t>(size_.x) * static_cast<std::size_t>(size_.y) * bytesPerPixel);
+
+    const std::uint8_t rgba[bytesPerPixel] = {toByte(color.r), toByte(color.g), toByte(color.b), toByte(color.a)};
+    for (std::size_t i = 0; i < pixels_.size(); i += bytesPerPixel)
+        std::memcpy(pixels_.data() + i, rgba, bytesPerPixel);
+}
+
+void Image::clear()
+{
+    pixels_.clear();
+    size_ = {};
+}
+
+bool Image::loadFromFile(const char *fileName)
+{
+    SDL_Surface *loaded = IMG_Load(fileName);
+    if (!loaded)
+    {
+        SDL_Log("%s", SDL_GetError());
+        return false;
+    }
+
+    SDL_Surface *rgba = SDL_ConvertSurface(loaded, SDL_PIXELFORMAT_RGBA32);
+    SDL_DestroySurface(loaded);
+    if (!rgba)
+    {
+        SDL_Log("%s", SDL_GetError());
+        return false;
+    }
+
+    size_ = {rgba->w, rgba->h};
+    pixels_.resize(static_cast<std::size_t>(size_.x) * static_cast<std::size_t>(size_.y) * bytesPerPixel);
+
+    SDL_LockSurface(rgba);
+    const std::size_t rowBytes = getPitch();
+    for (int y = 0; y < size_.y; ++y)
+        std::memcpy(pixels_.data() + static_cast<std::size_t>(y) * rowBytes,
+                    static_cast<const std::uint8_t *>(rgba->pixels) + static_cast<std::size_t>(y) * static_cast<std::size_t>(rgba->pitch),
+                    rowBytes);
+    SDL_UnlockSurface(rgba);
+    SDL_DestroySurface(rgba);
+    return true;
+}
+
+bool Image::saveToFile(const char *fileName) const
+{
+    if (pixels_.empty())
+        return false;
+
+    // Поверхность только ссылается на буфер изображения, копии нет
+    SDL_Surface *surface = SDL_CreateSurfaceFrom(size_.x, size_.y, SDL_PIXELFORMAT_RGBA32,
+                                                 const_cast<std::uint8_t *>(pixels_.data()), static_cast<int>(getPitch()));
+    if (!surface)
+    {
+        SDL_Log("%s", SDL_GetError());
+        return false;
+    }
+
+    const bool res = hasPngExtension(fileName) ? IMG_SavePNG(surface, fileName) : SDL_SaveBMP(surface, fileName);
+    if (!res)
+        SDL_Log("%s", SDL_GetError());
+    SDL_DestroySurface(surface);
+    return res;
+}
+
+const Vector2i &Image::getSize() const
+{
+    return size_;
+}
+
+std::size_t Image::getPitch() const
+{
+    return static_cast<std::size_t>(size_.x) * bytesPerPixel;
+}
+
+const std::uint8_t *Image::getPixels() const
+{
+    return pixels_.data();
+}
+
+std::uint8_t *Image::getPixels()
+{
+    return pixels_.data();
+}
+
+Color Image::getPixel(const Vector2i &position) const
+{
+    if (position.x < 0 || position.y < 0 || position.x >= size_.x || position.y >= size_.y)
+        return {};
+    const std::uint8_t *p = pixels_.data() + static_cast<std::size_t>(position.y) * getPitch() +
+                            static_cast<std::size_t>(position.x) * bytesPerPixel;
+    return Color::toColor(p[0], p[1], p[2], p[3]);
+}
+
+void Image::setPixel(const Vector2i &position, const Color &color)
+{
+    if (position.x < 0 || position.y < 0 || position.x >= size_.x || position.y >= size_.y)
+        return;
+    std::uint8_t *p = pixels_.data() + static_cast<std::size_t>(position.y) * getPitch() +
+                      static_cast<std::size_t>(position.x) * bytesPerPixel;
+    p[0] = toByte(color.r);
+    p[1] = toByte(color.g);
+    p[2] = toByte(color.b);
+    p[3] = toByte(color.a);
+}
+
+} // namespace sdl3
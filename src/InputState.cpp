@@ -0,0 +1,173 @@
+#include <SDL_wrapper/Core/InputState.hpp>
+
+namespace sdl3
+{
+
+void InputState::beginFrame()
+{
+    keysPressed_.reset();
+    keysReleased_.reset();
+    buttonsPressed_ = 0;
+    buttonsReleased_ = 0;
+    mouseDelta_ = {};
+    wheelDelta_ = {};
+    ++frame_;
+}
+
+void InputState::processEvent(const SDL_Event &event)
+{
+    switch (event.type)
+    {
+    case SDL_EVENT_KEY_DOWN:
+    case SDL_EVENT_KEY_UP:
+        setKey(event.key.scancode, event.key.down, event.key.repeat);
+        break;
+
+    case SDL_EVENT_MOUSE_MOTION:
+        mousePosition_ = {event.motion.x, event.motion.y};
+        mouseDelta_ += Vector2f{event.motion.xrel, event.motion.yrel};
+        break;
+
+    case SDL_EVENT_MOUSE_BUTTON_DOWN:
+    case SDL_EVENT_MOUSE_BUTTON_UP:
+        mousePosition_ = {event.button.x, event.button.y};
+        setButton(event.button.button, event.button.down);
+        break;
+
+    case SDL_EVENT_MOUSE_WHEEL:
+    {
+        // Приводим к обычному направлению прокрутки
+        const float sign = event.wheel.direction == SDL_MOUSEWHEEL_FLIPPED ? -1.f : 1.f;
+        wheelDelta_ += Vector2f{event.wheel.x * sign, event.wheel.y * sign};
+        break;
+    }
+
+    case SDL_EVENT_FINGER_DOWN:
+    case SDL_EVENT_FINGER_MOTION:
+    {
+        TouchPoint *touch = findTouch(event.tfinger.touchID, event.tfinger.fingerID);
+        if (!touch)
+        {
+            if (touchCount_ == maxTouches)
+                break;
+            touch = &touches_[touchCount_++];
+            touch->touchID = event.tfinger.touchID;
+            touch->fingerID = event.tfinger.fingerID;
+        }
+        touch->position = {event.tfinger.x, event.tfinger.y};
+        touch->pressure = event.tfinger.pressure;
+        break;
+    }
+
+    case SDL_EVENT_FINGER_UP:
+    case SDL_EVENT_FINGER_CANCELED:
+        if (TouchPoint *touch = findTouch(event.tfinger.touchID, event.tfinger.fingerID))
+        {
+            *touch = touches_[touchCount_ - 1];
+            --touchCount_;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+void InputState::processEvents(const std::span<const SDL_Event> events)
+{
+    for (const SDL_Event &event : events)
+        processEvent(event);
+}
+
+std::uint64_t InputState::getFrame() const
+{
+    return frame_;
+}
+
+bool InputState::isKeyDown(const SDL_Scancode scancode) const
+{
+    return scancode < SDL_SCANCODE_COUNT && keysDown_.test(scancode);
+}
+
+bool InputState::wasKeyPressed(const SDL_Scancode scancode) const
+{
+    return scancode < SDL_SCANCODE_COUNT && keysPressed_.test(scancode);
+}
+
+bool InputState::wasKeyReleased(const SDL_Scancode scancode) const
+{
+    return scancode < SDL_SCANCODE_COUNT && keysReleased_.test(scancode);
+}
+
+bool InputState::isMouseButtonDown(const std::uint8_t button) const
+{
+    return (buttonsDown_ & buttonBit(button)) != 0;
+}
+
+bool InputState::wasMouseButtonPressed(const std::uint8_t button) const
+{
+    return (buttonsPressed_ & buttonBit(button)) != 0;
+}
+
+bool InputState::wasMouseButtonReleased(const std::uint8_t button) const
+{
+    return (buttonsReleased_ & buttonBit(button)) != 0;
+}
+
+const Vector2f &InputState::getMousePosition() const
+{
+    return mousePosition_;
+}
+
+const Vector2f &InputState::getMouseDelta() const
+{
+    return mouseDelta_;
+}
+
+const Vector2f &InputState::getWheelDelta() const
+{
+    return wheelDelta_;
+}
+
+std::span<const TouchPoint> InputState::getTouches() const
+{
+    return std::span<const TouchPoint>(touches_.data(), touchCount_);
+}
+
+std::uint32_t InputState::buttonBit(const std::uint8_t button)
+{
+    return button >= 1 && button <= 32 ? 1u << (button - 1) : 0u;
+}
+
+TouchPoint *InputState::findTouch(const std::uint64_t touchID, const std::uint64_t fingerID)
+{
+    for (std::size_t i = 0; i < touchCount_; ++i)
+        if (touches_[i].touchID == touchID && touches_[i].fingerID == fingerID)
+            return &touches_[i];
+    return nullptr;
+}
+
+void InputState::setKey(const SDL_Scancode scancode, const bool down, const bool repeat)
+{
+    if (scancode >= SDL_SCANCODE_COUNT)
+        return;
+
+    // Автоповтор не даёт нового фронта; нажатие и отпускание в одном кадре видны оба
+    if (down && !repeat && !keysDown_.test(scancode))
+        keysPressed_.set(scancode);
+    if (!down && keysDown_.test(scancode))
+        keysReleased_.set(scancode);
+    keysDown_.set(scancode, down);
+}
+
+void InputState::setButton(const std::uint8_t button, const bool down)
+{
+    const std::uint32_t bit = buttonBit(button);
+    if (down && !(buttonsDown_ & bit))
+        buttonsPressed_ |= bit;
+    if (!down && (buttonsDown_ & bit))
+        buttonsReleased_ |= bit;
+    buttonsDown_ = down ? (buttonsDown_ | bit) : (buttonsDown_ & ~bit);
+}
+
+} // namespace sdl3
@@ -0,0 +1,260 @@
+#include <SDL_wrapper/Graphics/DrawTransformObjects/InstancedMesh.hpp>
+
+#include <cmath>
+#include <utility>
+
+#include <SDL3/SDL_stdinc.h>
+
+#include <SDL_wrapper/Graphics/ObjectBase/Shape.hpp>
+#include <SDL_wrapper/Graphics/Renders/RenderTarget.hpp>
+
+namespace sdl3
+{
+
+void InstancedMesh::setMesh(const Shape &shape)
+{
+    const std::shared_ptr<const detail::ShapeMesh> &mesh = shape.mesh_;
+    if (!mesh || !mesh->indices)
+    {
+        setMesh({}, {});
+        return;
+    }
+
+    std::vector<Vector2f> vertices = mesh->vertices;
+    std::vector<int> indices = *mesh->indices;
+    std::vector<Color> colors(vertices.size(), shape.fillColor_);
+    std::vector<Vector2f> uv;
+    if (shape.texture_)
+        uv = mesh->textureUV;
+    else if (shape.outlineThickness_ != 0.f)
+    {
+        // Обводка фигуры - несвязанные треугольники подряд
+        const int base = static_cast<int>(vertices.size());
+        vertices.insert(vertices.end(), mesh->outlineVertices.begin(), mesh->outlineVertices.end());
+        colors.resize(vertices.size(), shape.outlineColor_);
+        for (int i = 0; i < static_cast<int>(mesh->outlineVertices.size()); ++i)
+            indices.push_back(base + i);
+    }
+
+    texture_ = shape.texture_;
+    setMesh(std::move(vertices), std::move(indices), std::move(colors), std::move(uv));
+}
+
+void InstancedMesh::setMesh(std::vector<Vector2f> vertices, std::vector<int> indices,
+                            std::vector<Color> colors, std::vector<Vector2f> uv)
+{
+    localVertices_ = std::move(vertices);
+    localIndices_ = std::move(indices);
+    localColors_ = std::move(colors);
+    localUV_ = std::move(uv);
+
+    localColors_.resize(localVertices_.size(), Colors::White);
+    if (localUV_.size() != localVertices_.size())
+        localUV_.clear();
+    layoutDirty_ = true;
+}
+
+void InstancedMesh::setTexture(const Texture *texture)
+{
+    texture_ = texture;
+}
+
+const Texture *InstancedMesh::getTexture() const
+{
+    return texture_;
+}
+
+std::size_t InstancedMesh::addInstance(const MeshInstance &instance)
+{
+    instances_.push_back(instance);
+    dirtyFlags_.push_back(0);
+    markDirty(instances_.size() - 1);
+    return instances_.size() - 1;
+}
+
+void InstancedMesh::setInstance(const std::size_t index, const MeshInstance &instance)
+{
+    if (index >= instances_.size())
+        return;
+    instances_[index] = instance;
+    markDirty(index);
+}
+
+const MeshInstance &InstancedMesh::getInstance(const std::size_t index) const
+{
+    return instances_[index];
+}
+
+void InstancedMesh::removeInstance(const std::size_t index)
+{
+    if (index >= instances_.size())
+        return;
+    const std::size_t last = instances_.size() - 1;
+    if (index != last)
+    {
+        instances_[index] = instances_[last];
+        markDirty(index);
+    }
+    // Индекс last мог остаться в списке изменённых: prepare пропускает номера за концом
+    instances_.pop_back();
+    dirtyFlags_.pop_back();
+}
+
+void InstancedMesh::setInstances(std::vector<MeshInstance> instances)
+{
+    instances_ = std::move(instances);
+    dirtyFlags_.assign(instances_.size(), 0);
+    dirtyList_.clear();
+    allDirty_ = true;
+}
+
+void InstancedMesh::clearInstances()
+{
+    setInstances({});
+}
+
+void InstancedMesh::reserveInstances(const std::size_t count)
+{
+    instances_.reserve(count);
+    dirtyFlags_.reserve(count);
+}
+
+std::size_t InstancedMesh::getInstanceCount() const
+{
+    return instances_.size();
+}
+
+const std::vector<MeshInstance> &InstancedMesh::getInstances() const
+{
+    return instances_;
+}
+
+void InstancedMesh::markDirty(const std::size_t index)
+{
+    if (allDirty_ || dirtyFlags_[index])
+        return;
+    dirtyFlags_[index] = 1;
+    dirtyList_.push_back(index);
+}
+
+bool InstancedMesh::needsUpdate() const
+{
+    return allDirty_ || layoutDirty_ || !dirtyList_.empty() || builtInstances_ != instances_.size();
+}
+
+void InstancedMesh::draw(RenderTarget &target) const
+{
+    if (viewID_ != target.getViewId() || isGeometryDirty() || needsUpdate())
+        prepare(target.getRenderContext());
+
+    if (indices_.empty())
+        return;
+
+    target.drawGeometry(texture_,
+                        vertices_.data(), colors_.data(), uv_.empty() ? nullptr : uv_.data(),
+                        static_cast<int>(vertices_.size()),
+                        indices_.data(), static_cast<int>(indices_.size()));
+}
+
+void InstancedMesh::prepare(const RenderContext &context) const
+{
+    const bool viewDirty = viewID_ != context.viewId || isGeometryDirty();
+    if (!viewDirty && !needsUpdate())
+        return;
+
+    resizeBuffers();
+
+    const Matrix3x3<float> base = context.viewMatrix * getTransformMatrix();
+    if (allDirty_ || viewDirty)
+    {
+        for (std::size_t i = 0; i < instances_.size(); ++i)
+            expandInstance(i, base);
+    }
+    else
+    {
+        for (const std::size_t i : dirtyList_)
+            if (i < instances_.size())
+                expandInstance(i, base);
+    }
+
+    for (const std::size_t i : dirtyList_)
+        if (i < dirtyFlags_.size())
+            dirtyFlags_[i] = 0;
+    dirtyList_.clear();
+    allDirty_ = false;
+
+    viewID_ = context.viewId;
+    updateGeometryVersion();
+}
+
+void InstancedMesh::resizeBuffers() const
+{
+    if (layoutDirty_)
+    {
+        vertices_.clear();
+        colors_.clear();
+        uv_.clear();
+        indices_.clear();
+        builtInstances_ = 0;
+        layoutDirty_ = false;
+        allDirty_ = true;
+    }
+
+    const std::size_t count = instances_.size();
+    if (count == builtInstances_)
+        return;
+
+    const std::size_t n = localVertices_.size();
+    const std::size_t m = localIndices_.size();
+    vertices_.resize(count * n);
+    colors_.resize(count * n);
+
+    // UV и индексы от трансформа не зависят: дописываются только для новых экземпляров
+    if (count > builtInstances_)
+    {
+        uv_.reserve(localUV_.empty() ? 0 : count * n);
+        indices_.reserve(count * m);
+        for (std::size_t i = builtInstances_; i < count; ++i)
+        {
+            uv_.insert(uv_.end(), localUV_.begin(), localUV_.end());
+            const int offset = static_cast<int>(i * n);
+            for (const int index : localIndices_)
+                indices_.push_back(offset + index);
+        }
+    }
+    else
+    {
+        uv_.resize(localUV_.empty() ? 0 : count * n);
+        indices_.resize(count * m);
+    }
+    builtInstances_ = count;
+}
+
+void InstancedMesh::expandInstance(const std::size_t index, const Matrix3x3<float> &base) const
+{
+    const MeshInstance &instance = instances_[index];
+    const float angle = instance.rotation * (SDL_PI_F / 180.0f);
+    const float cosA = std::cos(angle);
+    const float sinA = std::sin(angle);
+
+    Matrix3x3<float> local;
+    local.a = instance.scale.x * cosA;
+    local.b = instance.scale.x * sinA;
+    local.c = -instance.scale.y * sinA;
+    local.d = instance.scale.y * cosA;
+    local.tx = instance.position.x;
+    local.ty = instance.position.y;
+
+    const std::size_t n = localVertices_.size();
+    (base * local).transformPoints(localVertices_.data(), vertices_.data() + index * n, n);
+
+    const Color &tint = instance.color;
+    Color *out = colors_.data() + index * n;
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        const Color &c = localColors_[k];
+        out[k] = {c.r * tint.r, c.g * tint.g, c.b * tint.b, c.a * tint.a};
+    }
+}
+
+} // namespace sdl3
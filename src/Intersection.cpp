@@ -0,0 +1,53 @@
+#include <SDL_wrapper/Core/Math/Intersection.hpp>
+
+#include <algorithm>
+
+namespace
+{
+
+using sdl3::Vector2f;
+
+void project(const std::span<const Vector2f> polygon, const Vector2f &axis, float &min, float &max)
+{
+    min = max = polygon[0].x * axis.x + polygon[0].y * axis.y;
+    for (std::size_t i = 1; i < polygon.size(); ++i)
+    {
+        const float p = polygon[i].x * axis.x + polygon[i].y * axis.y;
+        min = std::min(min, p);
+        max = std::max(max, p);
+    }
+}
+
+// Ищет разделяющую ось среди нормалей рёбер polygon. Нормировка не нужна: сравниваются проекции на одну ось
+bool hasSeparatingAxis(const std::span<const Vector2f> polygon, const std::span<const Vector2f> other)
+{
+    for (std::size_t i = 0; i < polygon.size(); ++i)
+    {
+        const Vector2f &p0 = polygon[i];
+        const Vector2f &p1 = polygon[(i + 1) % polygon.size()];
+        const Vector2f axis{p0.y - p1.y, p1.x - p0.x};
+        if (axis.x == 0.f && axis.y == 0.f)
+            continue;
+
+        float minA, maxA, minB, maxB;
+        project(polygon, axis, minA, maxA);
+        project(other, axis, minB, maxB);
+        if (maxA < minB || maxB < minA)
+            return true;
+    }
+    return false;
+}
+
+} // namespace
+
+namespace sdl3
+{
+
+bool intersectConvexPolygons(const std::span<const Vector2f> a, const std::span<const Vector2f> b)
+{
+    if (a.size() < 3 || b.size() < 3)
+        return false;
+    return !hasSeparatingAxis(a, b) && !hasSeparatingAxis(b, a);
+}
+
+} // namespace sdl3
@@ -0,0 +1,156 @@
+#include <SDL_wrapper/Core/MotionCoalescer.hpp>
+
+#include <algorithm>
+
+namespace sdl3
+{
+
+void MotionCoalescer::setPathRecording(const bool enabled)
+{
+    recordPath_ = enabled;
+    if (!enabled)
+    {
+        samples_.clear();
+        ranges_.clear();
+    }
+}
+
+bool MotionCoalescer::isPathRecording() const
+{
+    return recordPath_;
+}
+
+std::span<SDL_Event> MotionCoalescer::coalesce(std::span<SDL_Event> events)
+{
+    open_.clear();
+    entries_.clear();
+
+    std::size_t written = 0;
+    for (std::size_t i = 0; i < events.size(); ++i)
+    {
+        const SDL_Event &event = events[i];
+
+        StreamKey key;
+        if (!getStreamKey(event, key))
+        {
+            // Не движение: дальнейшие движения не должны перепрыгнуть через него
+            open_.clear();
+            events[written++] = event;
+            continue;
+        }
+
+        const auto stream = std::find_if(open_.begin(), open_.end(),
+                                         [&](const OpenStream &s) { return s.key == key; });
+
+        std::size_t target = written;
+        if (stream != open_.end())
+        {
+            target = stream->eventIndex;
+            merge(events[target], event);
+        }
+        else
+        {
+            events[written++] = event;
+            open_.push_back({key, target});
+        }
+
+        if (recordPath_)
+            entries_.push_back({target, getSample(event)});
+    }
+
+    if (recordPath_)
+        buildPaths();
+
+    return events.first(written);
+}
+
+std::span<const MotionSample> MotionCoalescer::getPath(const std::size_t eventIndex) const
+{
+    const auto it = std::lower_bound(ranges_.begin(), ranges_.end(), eventIndex,
+                                     [](const PathRange &range, const std::size_t index) { return range.eventIndex < index; });
+    if (it == ranges_.end() || it->eventIndex != eventIndex)
+        return {};
+    return std::span<const MotionSample>(samples_).subspan(it->first, it->count);
+}
+
+bool MotionCoalescer::getStreamKey(const SDL_Event &event, StreamKey &key)
+{
+    switch (event.type)
+    {
+    case SDL_EVENT_MOUSE_MOTION:
+        key = {event.type, event.motion.windowID, event.motion.which, 0};
+        return true;
+    case SDL_EVENT_FINGER_MOTION:
+        key = {event.type, event.tfinger.windowID, event.tfinger.touchID, event.tfinger.fingerID};
+        return true;
+    case SDL_EVENT_PEN_MOTION:
+        key = {event.type, event.pmotion.windowID, event.pmotion.which, 0};
+        return true;
+    default:
+        return false;
+    }
+}
+
+MotionSample MotionCoalescer::getSample(const SDL_Event &event)
+{
+    switch (event.type)
+    {
+    case SDL_EVENT_MOUSE_MOTION:
+        return {{event.motion.x, event.motion.y}, event.motion.timestamp};
+    case SDL_EVENT_FINGER_MOTION:
+        return {{event.tfinger.x, event.tfinger.y}, event.tfinger.timestamp};
+    case SDL_EVENT_PEN_MOTION:
+        return {{event.pmotion.x, event.pmotion.y}, event.pmotion.timestamp};
+    default:
+        return {};
+    }
+}
+
+void MotionCoalescer::merge(SDL_Event &into, const SDL_Event &next)
+{
+    switch (next.type)
+    {
+    case SDL_EVENT_MOUSE_MOTION:
+    {
+        const float xrel = into.motion.xrel + next.motion.xrel;
+        const float yrel = into.motion.yrel + next.motion.yrel;
+        into = next;
+        into.motion.xrel = xrel;
+        into.motion.yrel = yrel;
+        break;
+    }
+    case SDL_EVENT_FINGER_MOTION:
+    {
+        const float dx = into.tfinger.dx + next.tfinger.dx;
+        const float dy = into.tfinger.dy + next.tfinger.dy;
+        into = next;
+        into.tfinger.dx = dx;
+        into.tfinger.dy = dy;
+        break;
+    }
+    default:
+        into = next;
+        break;
+    }
+}
+
+void MotionCoalescer::buildPaths()
+{
+    // Точки разных потоков перемешаны: группируем по событию, сохраняя порядок внутри потока
+    std::stable_sort(entries_.begin(), entries_.end(),
+                     [](const PathEntry &a, const PathEntry &b) { return a.eventIndex < b.eventIndex; });
+
+    samples_.clear();
+    ranges_.clear();
+    samples_.reserve(entries_.size());
+
+    for (const PathEntry &entry : entries_)
+    {
+        if (ranges_.empty() || ranges_.back().eventIndex != entry.eventIndex)
+            ranges_.push_back({entry.eventIndex, samples_.size(), 0});
+        samples_.push_back(entry.sample);
+        ++ranges_.back().count;
+    }
+}
+
+} // namespace sdl3
@@ -0,0 +1,230 @@
+#include <SDL_wrapper/Graphics/DrawTransformObjects/NineSliceSprite.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <SDL_wrapper/Graphics/Renders/RenderTarget.hpp>
+#include <SDL_wrapper/Graphics/Texture.hpp>
+
+namespace
+{
+
+// Линии сетки по одной оси: край, внутренняя граница первого отступа, второго, край.
+// Отступы, не помещающиеся в длину, сжимаются пропорционально
+void sliceAxis(float out[4], const float origin, const float length, float first, float second)
+{
+    const float total = first + second;
+    const float extent = std::abs(length);
+    if (total > extent && total > 0.f)
+    {
+        const float k = extent / total;
+        first *= k;
+        second *= k;
+    }
+    const float sign = length < 0.f ? -1.f : 1.f;
+    out[0] = origin;
+    out[1] = origin + first * sign;
+    out[2] = origin + length - second * sign;
+    out[3] = origin + length;
+}
+
+constexpr std::array<int, 54> makeIndices()
+{
+    std::array<int, 54> indices{};
+    std::size_t n = 0;
+    for (int row = 0; row < 3; ++row)
+        for (int col = 0; col < 3; ++col)
+        {
+            const int i0 = row * 4 + col;
+            const int i1 = i0 + 1;
+            const int i2 = i0 + 5;
+            const int i3 = i0 + 4;
+            indices[n++] = i0;
+            indices[n++] = i1;
+            indices[n++] = i2;
+            indices[n++] = i2;
+            indices[n++] = i3;
+            indices[n++] = i0;
+        }
+    return indices;
+}
+
+} // namespace
+
+namespace sdl3
+{
+
+const std::array<int, NineSliceSprite::indexCount> NineSliceSprite::indices_ = makeIndices();
+
+NineSliceSprite::NineSliceSprite(const Texture &texture, const SliceInsets &insets)
+    : insets_(insets)
+{
+    setTexture(texture);
+}
+
+void NineSliceSprite::setFilterColor(const Color &color)
+{
+    color_ = color;
+}
+
+const Color &NineSliceSprite::getFilterColor() const
+{
+    return color_;
+}
+
+void NineSliceSprite::setTexture(const Texture &texture)
+{
+    const Vector2i size = texture.getSize();
+    setTexture(texture, {0.f, 0.f, static_cast<float>(size.x), static_cast<float>(size.y)});
+}
+
+void NineSliceSprite::setTexture(const Texture &texture, const FloatRect &textureRect)
+{
+    const bool firstTexture = !texture_;
+    texture_ = &texture;
+    textureRect_ = textureRect;
+    if (firstTexture && size_.x == 0.f && size_.y == 0.f)
+    {
+        size_ = {textureRect.w, textureRect.h};
+        updateLocalGeometry();
+    }
+    updateTextureCoords();
+}
+
+void NineSliceSprite::setTextureRect(const FloatRect &textureRect)
+{
+    textureRect_ = textureRect;
+    updateTextureCoords();
+}
+
+const Texture *NineSliceSprite::getTexture() const
+{
+    return texture_;
+}
+
+const FloatRect &NineSliceSprite::getTextureRect() const
+{
+    return textureRect_;
+}
+
+void NineSliceSprite::setInsets(const SliceInsets &insets)
+{
+    insets_ = insets;
+    updateLocalGeometry();
+    updateTextureCoords();
+}
+
+const SliceInsets &NineSliceSprite::getInsets() const
+{
+    return insets_;
+}
+
+void NineSliceSprite::setSize(const Vector2f &size)
+{
+    if (size_.x == size.x && size_.y == size.y)
+        return;
+    size_ = size;
+    updateLocalGeometry();
+}
+
+const Vector2f &NineSliceSprite::getSize() const
+{
+    return size_;
+}
+
+FloatRect NineSliceSprite::getLocalBounds() const
+{
+    return {0.f, 0.f, size_.x, size_.y};
+}
+
+FloatRect NineSliceSprite::getGlobalBounds() const
+{
+    return getTransformMatrix().transformRect(getLocalBounds());
+}
+
+bool NineSliceSprite::containsPoint(const Vector2f &point) const
+{
+    if (!texture_)
+        return false;
+
+    Matrix3x3<float> inverse;
+    if (!getTransformMatrix().tryInverse(inverse))
+        return false;
+
+    const Vector2f local = inverse.transform(point);
+    return local.x >= std::min(0.f, size_.x) && local.x <= std::max(0.f, size_.x) &&
+           local.y >= std::min(0.f, size_.y) && local.y <= std::max(0.f, size_.y);
+}
+
+unsigned NineSliceSprite::getPickVersion() const
+{
+    return getVersion() + localVersion_;
+}
+
+void NineSliceSprite::draw(RenderTarget &target) const
+{
+    if (!texture_)
+        return;
+
+    if (viewID_ != target.getViewId() || isGeometryDirty() || dirty_)
+        prepare(target.getRenderContext());
+    target.drawShape(texture_, vertices_, vertexCount, textureUV_, vertexCount, color_, indices_.data(), indexCount);
+}
+
+void NineSliceSprite::prepare(const RenderContext &context) const
+{
+    if (!texture_)
+        return;
+
+    if (viewID_ != context.viewId || isGeometryDirty() || dirty_)
+    {
+        updateVertices(context.viewMatrix * getTransformMatrix());
+        viewID_ = context.viewId;
+        updateGeometryVersion();
+    }
+}
+
+void NineSliceSprite::updateLocalGeometry()
+{
+    ++localVersion_;
+    float xs[gridSize];
+    float ys[gridSize];
+    sliceAxis(xs, 0.f, size_.x, insets_.left, insets_.right);
+    sliceAxis(ys, 0.f, size_.y, insets_.top, insets_.bottom);
+
+    for (int row = 0; row < gridSize; ++row)
+        for (int col = 0; col < gridSize; ++col)
+            localVertices_[row * gridSize + col] = {xs[col], ys[row]};
+    dirty_ = true;
+}
+
+void NineSliceSprite::updateTextureCoords()
+{
+    if (!texture_)
+        return;
+
+    const Vector2i texSize = texture_->getSize();
+    if (texSize.x <= 0 || texSize.y <= 0)
+        return;
+
+    // UV зависят только от текстуры и отступов: изменение размера или трансформа их не трогает
+    float us[gridSize];
+    float vs[gridSize];
+    sliceAxis(us, textureRect_.x, textureRect_.w, insets_.left, insets_.right);
+    sliceAxis(vs, textureRect_.y, textureRect_.h, insets_.top, insets_.bottom);
+
+    const float tw = static_cast<float>(texSize.x);
+    const float th = static_cast<float>(texSize.y);
+    for (int row = 0; row < gridSize; ++row)
+        for (int col = 0; col < gridSize; ++col)
+            textureUV_[row * gridSize + col] = {us[col] / tw, vs[row] / th};
+}
+
+void NineSliceSprite::updateVertices(const Matrix3x3<float> &matrix) const
+{
+    for (int i = 0; i < vertexCount; ++i)
+        vertices_[i] = matrix.transform(localVertices_[i]);
+    dirty_ = false;
+}
+
+} // namespace sdl3
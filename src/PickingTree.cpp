@@ -0,0 +1,263 @@
+#include <SDL_wrapper/Graphics/PickingTree.hpp>
+
+#include <algorithm>
+
+#include <SDL_wrapper/Core/SmallVector.hpp>
+
+namespace sdl3
+{
+
+PickingTree::Id PickingTree::insert(const Pickable &object, const int drawOrder)
+{
+    Id id = entries_.size();
+    if (!freeIds_.empty())
+    {
+        id = freeIds_.back();
+        freeIds_.pop_back();
+    }
+    else
+        entries_.emplace_back();
+
+    Entry &entry = entries_[id];
+    entry.object = &object;
+    entry.box = toBox(object.getGlobalBounds());
+    entry.version = object.getPickVersion();
+    entry.drawOrder = drawOrder;
+    entry.sequence = nextSequence_++;
+
+    ++liveCount_;
+    structureDirty_ = true;
+    return id;
+}
+
+bool PickingTree::remove(const Id id)
+{
+    if (id >= entries_.size() || !entries_[id].object)
+        return false;
+
+    entries_[id] = Entry{};
+    freeIds_.push_back(id);
+    --liveCount_;
+    structureDirty_ = true;
+    return true;
+}
+
+void PickingTree::clear()
+{
+    entries_.clear();
+    freeIds_.clear();
+    nodes_.clear();
+    items_.clear();
+    liveCount_ = 0;
+    movedSinceBuild_ = 0;
+    structureDirty_ = false;
+}
+
+void PickingTree::setDrawOrder(const Id id, const int drawOrder)
+{
+    if (id < entries_.size() && entries_[id].object)
+        entries_[id].drawOrder = drawOrder;
+}
+
+std::size_t PickingTree::getSize() const
+{
+    return liveCount_;
+}
+
+void PickingTree::update()
+{
+    std::size_t moved = 0;
+    for (Entry &entry : entries_)
+    {
+        if (!entry.object)
+            continue;
+        const unsigned version = entry.object->getPickVersion();
+        if (version == entry.version)
+            continue;
+        entry.version = version;
+        entry.box = toBox(entry.object->getGlobalBounds());
+        ++moved;
+    }
+
+    movedSinceBuild_ += moved;
+
+    // Подгонка сохраняет топологию и со временем раздувает узлы: после сдвига
+    // половины объектов дешевле построить дерево заново
+    if (structureDirty_ || movedSinceBuild_ * 2 > liveCount_)
+        rebuild();
+    else if (moved)
+        refit();
+}
+
+const Pickable *PickingTree::pick(const Vector2f &point) const
+{
+    collectCandidates(point);
+
+    // Кандидаты сверху вниз: точная проверка останавливается на первом попадании
+    std::sort(candidates_.begin(), candidates_.end(),
+              [this](const std::uint32_t a, const std::uint32_t b) { return isAbove(a, b); });
+
+    for (const std::uint32_t index : candidates_)
+        if (entries_[index].object->containsPoint(point))
+            return entries_[index].object;
+    return nullptr;
+}
+
+void PickingTree::pickAll(const Vector2f &point, std::vector<const Pickable *> &out) const
+{
+    out.clear();
+    collectCandidates(point);
+
+    std::sort(candidates_.begin(), candidates_.end(),
+              [this](const std::uint32_t a, const std::uint32_t b) { return isAbove(a, b); });
+
+    for (const std::uint32_t index : candidates_)
+        if (entries_[index].object->containsPoint(point))
+            out.push_back(entries_[index].object);
+}
+
+PickingTree::Box PickingTree::toBox(const FloatRect &rect)
+{
+    return {std::min(rect.x, rect.x + rect.w), std::min(rect.y, rect.y + rect.h),
+            std::max(rect.x, rect.x + rect.w), std::max(rect.y, rect.y + rect.h)};
+}
+
+bool PickingTree::contains(const Box &box, const Vector2f &point)
+{
+    return point.x >= box.minX && point.x <= box.maxX && point.y >= box.minY && point.y <= box.maxY;
+}
+
+void PickingTree::expand(Box &box, const Box &other)
+{
+    box.minX = std::min(box.minX, other.minX);
+    box.minY = std::min(box.minY, other.minY);
+    box.maxX = std::max(box.maxX, other.maxX);
+    box.maxY = std::max(box.maxY, other.maxY);
+}
+
+bool PickingTree::isAbove(const std::uint32_t left, const std::uint32_t right) const
+{
+    const Entry &a = entries_[left];
+    const Entry &b = entries_[right];
+    if (a.drawOrder != b.drawOrder)
+        return a.drawOrder > b.drawOrder;
+    return a.sequence > b.sequence;
+}
+
+void PickingTree::rebuild()
+{
+    structureDirty_ = false;
+    movedSinceBuild_ = 0;
+
+    items_.clear();
+    nodes_.clear();
+    for (std::size_t i = 0; i < entries_.size(); ++i)
+        if (entries_[i].object)
+            items_.push_back(static_cast<std::uint32_t>(i));
+
+    if (items_.empty())
+        return;
+
+    nodes_.reserve(2 * (items_.size() / leafSize + 1));
+    nodes_.push_back({{}, 0, static_cast<std::uint32_t>(items_.size())});
+
+    auto centerX = [this](const std::uint32_t i) { return entries_[i].box.minX + entries_[i].box.maxX; };
+    auto centerY = [this](const std::uint32_t i) { return entries_[i].box.minY + entries_[i].box.maxY; };
+
+    // Узел в стеке ещё хранит свой диапазон объектов; делим по медиане центров вдоль длинной оси
+    SmallVector<std::uint32_t, 64> stack;
+    stack.push_back(0);
+    while (!stack.empty())
+    {
+        const std::uint32_t nodeIndex = stack.back();
+        stack.pop_back();
+
+        const std::uint32_t first = nodes_[nodeIndex].first;
+        const std::uint32_t count = nodes_[nodeIndex].count;
+
+        Box box = entries_[items_[first]].box;
+        Box centers{centerX(items_[first]), centerY(items_[first]), centerX(items_[first]), centerY(items_[first])};
+        for (std::uint32_t i = first + 1; i < first + count; ++i)
+        {
+            expand(box, entries_[items_[i]].box);
+            const float cx = centerX(items_[i]);
+            const float cy = centerY(items_[i]);
+            expand(centers, {cx, cy, cx, cy});
+        }
+        nodes_[nodeIndex].box = box;
+
+        if (count <= leafSize)
+            continue;
+
+        const auto begin = items_.begin() + first;
+        const auto mid = begin + count / 2;
+        const auto end = begin + count;
+        if (centers.maxX - centers.minX >= centers.maxY - centers.minY)
+            std::nth_element(begin, mid, end, [&](const std::uint32_t a, const std::uint32_t b) { return centerX(a) < centerX(b); });
+        else
+            std::nth_element(begin, mid, end, [&](const std::uint32_t a, const std::uint32_t b) { return centerY(a) < centerY(b); });
+
+        const auto child = static_cast<std::uint32_t>(nodes_.size());
+        nodes_.push_back({{}, first, count / 2});
+        nodes_.push_back({{}, first + count / 2, count - count / 2});
+        nodes_[nodeIndex].first = child;
+        nodes_[nodeIndex].count = 0;
+
+        stack.push_back(child);
+        stack.push_back(child + 1);
+    }
+}
+
+void PickingTree::refit()
+{
+    // Дети всегда лежат после родителя, поэтому обратный проход идёт снизу вверх
+    for (std::size_t i = nodes_.size(); i-- > 0;)
+    {
+        Node &node = nodes_[i];
+        if (node.count > 0)
+        {
+            Box box = entries_[items_[node.first]].box;
+            for (std::uint32_t k = node.first + 1; k < node.first + node.count; ++k)
+                expand(box, entries_[items_[k]].box);
+            node.box = box;
+        }
+        else
+        {
+            node.box = nodes_[node.first].box;
+            expand(node.box, nodes_[node.first + 1].box);
+        }
+    }
+}
+
+void PickingTree::collectCandidates(const Vector2f &point) const
+{
+    candidates_.clear();
+    if (nodes_.empty())
+        return;
+
+    SmallVector<std::uint32_t, 64> stack;
+    stack.push_back(0);
+    while (!stack.empty())
+    {
+        const Node &node = nodes_[stack.back()];
+        stack.pop_back();
+
+        if (!contains(node.box, point))
+            continue;
+
+        if (node.count > 0)
+        {
+            // Удалённые после последнего update() объекты ещё лежат в листьях
+            for (std::uint32_t k = node.first; k < node.first + node.count; ++k)
+                if (entries_[items_[k]].object && contains(entries_[items_[k]].box, point))
+                    candidates_.push_back(items_[k]);
+        }
+        else
+        {
+            stack.push_back(node.first);
+            stack.push_back(node.first + 1);
+        }
+    }
+}
+
+} // namespace sdl3
@@ -19,6 +19,22 @@ const std::vector<Vector2f> &PolygonShape::getPoints() const
     return points_;
 }
 
+void PolygonShape::setHoles(std::vector<std::vector<Vector2f>> holes)
+{
+    holes_ = std::move(holes);
+    updateLocalGeometry();
+}
+
+const std::vector<std::vector<Vector2f>> &PolygonShape::getHoles() const
+{
+    return holes_;
+}
+
+std::span<const std::vector<Vector2f>> PolygonShape::getLocalHoles() const
+{
+    return holes_;
+}
+
 std::size_t PolygonShape::getPointCount() const
 {
     return points_.size();
@@ -0,0 +1,343 @@
+#include <SDL_wrapper/Graphics/DrawTransformObjects/Polyline.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <SDL3/SDL_stdinc.h>
+
+#include <SDL_wrapper/Core/Math/VectorMath.hpp>
+#include <SDL_wrapper/Graphics/Renders/RenderTarget.hpp>
+
+namespace
+{
+
+using sdl3::Vector2f;
+
+constexpr float minSegmentLength = 1e-6f;
+
+float perpDot(const Vector2f &v1, const Vector2f &v2)
+{
+    return v1.x * v2.y - v1.y * v2.x;
+}
+
+class StrokeBuilder
+{
+public:
+    StrokeBuilder(std::vector<Vector2f> &vertices, std::vector<int> &indices, const float halfWidth)
+        : vertices_(vertices), indices_(indices), halfWidth_(halfWidth)
+    {
+    }
+
+    int addVertex(const Vector2f &p)
+    {
+        vertices_.push_back(p);
+        return static_cast<int>(vertices_.size()) - 1;
+    }
+
+    void addTriangle(const int a, const int b, const int c)
+    {
+        indices_.push_back(a);
+        indices_.push_back(b);
+        indices_.push_back(c);
+    }
+
+    Vector2f &vertex(const int index)
+    {
+        return vertices_[static_cast<std::size_t>(index)];
+    }
+
+    // Веер вокруг center от вершины first до вершины last, offset - вектор от center до first
+    void addFan(const int center, const Vector2f &c, Vector2f offset, const float angle, const int first, const int last)
+    {
+        const int steps = arcSteps(std::abs(angle));
+        const float step = angle / static_cast<float>(steps);
+        const float cosS = std::cos(step);
+        const float sinS = std::sin(step);
+
+        int prev = first;
+        for (int i = 1; i < steps; ++i)
+        {
+            offset = {offset.x * cosS - offset.y * sinS, offset.x * sinS + offset.y * cosS};
+            const int idx = addVertex(c + offset);
+            addTriangle(center, prev, idx);
+            prev = idx;
+        }
+        addTriangle(center, prev, last);
+    }
+
+private:
+    std::vector<Vector2f> &vertices_;
+    std::vector<int> &indices_;
+    float halfWidth_;
+
+private:
+    int arcSteps(const float angle) const
+    {
+        // Хорда отклоняется от дуги не более чем на tolerance локальных единиц
+        constexpr float tolerance = 0.25f;
+        const float maxStep = halfWidth_ > tolerance
+                                  ? 2.f * std::acos(1.f - tolerance / halfWidth_)
+                                  : SDL_PI_F / 2.f;
+        return std::clamp(static_cast<int>(std::ceil(angle / maxStep)), 1, 64);
+    }
+};
+
+} // namespace
+
+namespace sdl3
+{
+
+Polyline::Polyline(std::vector<Vector2f> points, const float width)
+    : points_(std::move(points)), width_(width)
+{
+}
+
+void Polyline::setPoints(std::vector<Vector2f> points)
+{
+    points_ = std::move(points);
+    ++strokeVersion_;
+}
+
+void Polyline::addPoint(const Vector2f &point)
+{
+    points_.push_back(point);
+    ++strokeVersion_;
+}
+
+void Polyline::clearPoints()
+{
+    points_.clear();
+    ++strokeVersion_;
+}
+
+const std::vector<Vector2f> &Polyline::getPoints() const
+{
+    return points_;
+}
+
+void Polyline::setWidth(const float width)
+{
+    if (width_ == width)
+        return;
+    width_ = width;
+    ++strokeVersion_;
+}
+
+float Polyline::getWidth() const
+{
+    return width_;
+}
+
+void Polyline::setJoin(const LineJoin join)
+{
+    if (join_ == join)
+        return;
+    join_ = join;
+    ++strokeVersion_;
+}
+
+LineJoin Polyline::getJoin() const
+{
+    return join_;
+}
+
+void Polyline::setCap(const LineCap cap)
+{
+    if (cap_ == cap)
+        return;
+    cap_ = cap;
+    ++strokeVersion_;
+}
+
+LineCap Polyline::getCap() const
+{
+    return cap_;
+}
+
+void Polyline::setMiterLimit(const float limit)
+{
+    const float clamped = std::max(limit, 1.f);
+    if (miterLimit_ == clamped)
+        return;
+    miterLimit_ = clamped;
+    ++strokeVersion_;
+}
+
+float Polyline::getMiterLimit() const
+{
+    return miterLimit_;
+}
+
+void Polyline::setColor(const Color &color)
+{
+    color_ = color;
+}
+
+const Color &Polyline::getColor() const
+{
+    return color_;
+}
+
+void Polyline::prepare(const RenderContext &context) const
+{
+    if (tessellatedVersion_ != strokeVersion_)
+    {
+        tessellate();
+        tessellatedVersion_ = strokeVersion_;
+        dirty_ = true;
+    }
+
+    if (indices_.empty())
+        return;
+
+    if (viewID_ != context.viewId || isGeometryDirty() || dirty_)
+    {
+        updateVertices(context.viewMatrix * getTransformMatrix());
+        viewID_ = context.viewId;
+        updateGeometryVersion();
+    }
+}
+
+void Polyline::draw(RenderTarget &target) const
+{
+    if (tessellatedVersion_ != strokeVersion_ || viewID_ != target.getViewId() || isGeometryDirty() || dirty_)
+        prepare(target.getRenderContext());
+
+    if (indices_.empty())
+        return;
+
+    target.drawShape(nullptr,
+                     vertices_.data(), static_cast<int>(vertices_.size()),
+                     nullptr, 0,
+                     color_,
+                     indices_.data(), static_cast<int>(indices_.size()));
+}
+
+void Polyline::tessellate() const
+{
+    localVertices_.clear();
+    indices_.clear();
+
+    const float hw = width_ / 2.f;
+    if (hw <= 0.f || points_.size() < 2)
+        return;
+
+    localVertices_.reserve(points_.size() * 5);
+    indices_.reserve(points_.size() * 12);
+
+    StrokeBuilder builder(localVertices_, indices_, hw);
+
+    // Концы предыдущего сегмента: левая (+n) и правая (-n) вершины
+    Vector2f prevDir{};
+    Vector2f prevNormal{};
+    int prevEndL = -1;
+    int prevEndR = -1;
+    Vector2f a = points_.front();
+
+    for (std::size_t i = 1; i < points_.size(); ++i)
+    {
+        const Vector2f &b = points_[i];
+        const Vector2f delta = b - a;
+        const float len = length(delta);
+        if (len < minSegmentLength)
+            continue;
+
+        const Vector2f dir = delta / len;
+        const Vector2f normal = {-dir.y, dir.x};
+        const Vector2f offset = normal * hw;
+        const bool first = prevEndL < 0;
+
+        Vector2f start = a;
+        if (first && cap_ == LineCap::Square)
+            start -= dir * hw;
+
+        const int startL = builder.addVertex(start + offset);
+        const int startR = builder.addVertex(start - offset);
+        const int endL = builder.addVertex(b + offset);
+        const int endR = builder.addVertex(b - offset);
+        builder.addTriangle(startL, startR, endR);
+        builder.addTriangle(startL, endR, endL);
+
+        if (first)
+        {
+            if (cap_ == LineCap::Round)
+            {
+                const int center = builder.addVertex(a);
+                builder.addFan(center, a, offset, SDL_PI_F, startL, startR);
+            }
+        }
+        else
+        {
+            const float turn = perpDot(prevDir, dir);
+            const bool collinear = std::abs(turn) < 1e-6f && dot(prevDir, dir) > 0.f;
+            if (!collinear)
+            {
+                // Внешняя сторона поворота: при turn > 0 это правая сторона (-n)
+                const float side = turn > 0.f ? -1.f : 1.f;
+                const int prevOuter = turn > 0.f ? prevEndR : prevEndL;
+                const int curOuter = turn > 0.f ? startR : startL;
+                const Vector2f prevOuterN = prevNormal * side;
+                const Vector2f curOuterN = normal * side;
+                const int center = builder.addVertex(a);
+
+                switch (join_)
+                {
+                case LineJoin::Miter:
+                {
+                    const Vector2f miter = normalize(prevOuterN + curOuterN);
+                    const float cosHalf = dot(miter, prevOuterN);
+                    if (cosHalf * miterLimit_ >= 1.f)
+                    {
+                        const int tip = builder.addVertex(a + miter * (hw / cosHalf));
+                        builder.addTriangle(center, prevOuter, tip);
+                        builder.addTriangle(center, tip, curOuter);
+                    }
+                    else
+                        builder.addTriangle(center, prevOuter, curOuter);
+                    break;
+                }
+                case LineJoin::Round:
+                {
+                    const float angle = std::acos(std::clamp(dot(prevOuterN, curOuterN), -1.f, 1.f));
+                    builder.addFan(center, a, prevOuterN * hw, turn > 0.f ? angle : -angle, prevOuter, curOuter);
+                    break;
+                }
+                case LineJoin::Bevel:
+                default:
+                    builder.addTriangle(center, prevOuter, curOuter);
+                    break;
+                }
+            }
+        }
+
+        prevDir = dir;
+        prevNormal = normal;
+        prevEndL = endL;
+        prevEndR = endR;
+        a = b;
+    }
+
+    if (prevEndL < 0)
+        return;
+
+    if (cap_ == LineCap::Square)
+    {
+        builder.vertex(prevEndL) += prevDir * hw;
+        builder.vertex(prevEndR) += prevDir * hw;
+    }
+    else if (cap_ == LineCap::Round)
+    {
+        const int center = builder.addVertex(a);
+        builder.addFan(center, a, prevNormal * -hw, SDL_PI_F, prevEndR, prevEndL);
+    }
+}
+
+void Polyline::updateVertices(const Matrix3x3<float> &matrix) const
+{
+    vertices_.resize(localVertices_.size());
+    for (std::size_t i = 0; i < localVertices_.size(); ++i)
+        vertices_[i] = matrix.transform(localVertices_[i]);
+    dirty_ = false;
+}
+
+} // namespace sdl3
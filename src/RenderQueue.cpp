@@ -0,0 +1,183 @@
+#include <SDL_wrapper/Graphics/Detail/RenderQueue.hpp>
+
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_log.h>
+
+namespace sdl3::detail
+{
+
+void CommandList::clear()
+{
+    const std::size_t commandCap = commands.capacity();
+    const std::size_t textureCap = textures.capacity();
+    const std::size_t vertexCap = positions.capacity();
+    const std::size_t indexCap = indices.capacity();
+
+    // Сначала освобождаются элементы и ссылки на текстуры, затем память арены
+    commands = std::pmr::vector<RenderCommand>(&arena);
+    textures = std::pmr::vector<std::shared_ptr<SDL_Texture>>(&arena);
+    positions = std::pmr::vector<Vector2f>(&arena);
+    colors = std::pmr::vector<SDL_FColor>(&arena);
+    uv = std::pmr::vector<Vector2f>(&arena);
+    indices = std::pmr::vector<int>(&arena);
+    arena.reset();
+
+    // Ёмкость прошлого кадра сразу: арена уже слита в один блок, вектора не растут удвоением
+    commands.reserve(commandCap);
+    textures.reserve(textureCap);
+    positions.reserve(vertexCap);
+    colors.reserve(vertexCap);
+    uv.reserve(vertexCap);
+    indices.reserve(indexCap);
+}
+
+RenderQueue::RenderQueue(std::shared_ptr<SDL_Renderer> renderer, std::shared_ptr<std::recursive_mutex> rendererMtx)
+    : renderer_(std::move(renderer)), rendererMtx_(std::move(rendererMtx))
+{
+    targetCenter_ = queryTargetCenter(renderer_.get());
+    thread_ = std::thread(&RenderQueue::threadLoop, this);
+}
+
+RenderQueue::~RenderQueue()
+{
+    waitIdle();
+    {
+        std::lock_guard lk(mtx_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    thread_.join();
+
+    // Текстуры записываемого кадра освобождаются под блокировкой рендера, как и в потоке
+    std::lock_guard lk(*rendererMtx_);
+    lists_[0].clear();
+    lists_[1].clear();
+}
+
+Vector2f RenderQueue::queryTargetCenter(SDL_Renderer *renderer)
+{
+    if (!renderer)
+        return Vector2f{0.0f, 0.0f};
+
+    int logicalW = 0;
+    int logicalH = 0;
+    SDL_RendererLogicalPresentation logicalMode = SDL_LOGICAL_PRESENTATION_DISABLED;
+    if (SDL_GetRenderLogicalPresentation(renderer, &logicalW, &logicalH, &logicalMode) &&
+        logicalMode != SDL_LOGICAL_PRESENTATION_DISABLED &&
+        logicalW > 0 && logicalH > 0)
+    {
+        // При включённом logical presentation координатная система рендера становится "логической",
+        // поэтому центр должен быть в логических единицах, а не в пикселях реального output-size.
+        return Vector2f{logicalW / 2.0f, logicalH / 2.0f};
+    }
+
+    int w = 0;
+    int h = 0;
+    if (!SDL_GetCurrentRenderOutputSize(renderer, &w, &h))
+        SDL_Log("%s", SDL_GetError());
+
+    return Vector2f{w / 2.0f, h / 2.0f};
+}
+
+CommandList &RenderQueue::recording()
+{
+    return lists_[recordIndex_];
+}
+
+void RenderQueue::submitFrame()
+{
+    std::unique_lock lk(mtx_);
+    cv_.wait(lk, [this]
+    {
+        return !pending_;
+    });
+    recordIndex_ ^= 1;
+    pending_ = true;
+    lk.unlock();
+    cv_.notify_all();
+}
+
+void RenderQueue::waitIdle()
+{
+    std::unique_lock lk(mtx_);
+    cv_.wait(lk, [this]
+    {
+        return !pending_;
+    });
+}
+
+Vector2f RenderQueue::getTargetCenter() const
+{
+    std::lock_guard lk(centerMtx_);
+    return targetCenter_;
+}
+
+void RenderQueue::threadLoop()
+{
+    while (true)
+    {
+        std::size_t replayIndex = 0;
+        {
+            std::unique_lock lk(mtx_);
+            cv_.wait(lk, [this]
+            {
+                return pending_ || stop_;
+            });
+            if (stop_)
+                return;
+            // Пока pending_, записывающий поток не трогает этот список
+            replayIndex = recordIndex_ ^ 1;
+        }
+
+        CommandList &list = lists_[replayIndex];
+        Vector2f center;
+        {
+            std::lock_guard rl(*rendererMtx_);
+            replay(list);
+            SDL_RenderPresent(renderer_.get());
+            center = queryTargetCenter(renderer_.get());
+            list.clear();
+        }
+
+        {
+            std::lock_guard lk(centerMtx_);
+            targetCenter_ = center;
+        }
+
+        {
+            std::lock_guard lk(mtx_);
+            pending_ = false;
+        }
+        cv_.notify_all();
+    }
+}
+
+void RenderQueue::replay(const CommandList &list)
+{
+    SDL_Renderer *renderer = renderer_.get();
+    for (const RenderCommand &cmd : list.commands)
+    {
+        switch (cmd.type)
+        {
+        case RenderCommand::Type::Clear:
+            SDL_SetRenderDrawColorFloat(renderer, cmd.color.r, cmd.color.g, cmd.color.b, cmd.color.a);
+            SDL_RenderClear(renderer);
+            break;
+
+        case RenderCommand::Type::Geometry:
+        {
+            SDL_Texture *texture = cmd.texture >= 0 ? list.textures[static_cast<std::size_t>(cmd.texture)].get() : nullptr;
+            const Vector2f *positions = list.positions.data() + cmd.firstVertex;
+            SDL_RenderGeometryRaw(renderer, texture,
+                                  &positions->x, sizeof(Vector2f),
+                                  list.colors.data() + cmd.firstVertex, sizeof(SDL_FColor),
+                                  texture ? &(list.uv.data() + cmd.firstVertex)->x : nullptr, sizeof(Vector2f),
+                                  cmd.vertexCount,
+                                  list.indices.data() + cmd.firstIndex, cmd.indexCount, sizeof(int));
+            break;
+        }
+        }
+    }
+}
+
+} // namespace sdl3::detail
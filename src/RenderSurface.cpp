@@ -0,0 +1,159 @@
+#include <SDL_wrapper/Graphics/Renders/RenderSurface.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_log.h>
+#include <SDL3/SDL_render.h>
+
+#include <SDL_wrapper/Graphics/Detail/RendererRegistry.hpp>
+
+namespace
+{
+
+struct SurfaceDeleter
+{
+    void operator()(SDL_Surface *surface) const noexcept
+    {
+        SDL_DestroySurface(surface);
+    }
+    void operator()(SDL_Renderer *renderer) const noexcept
+    {
+        SDL_DestroyRenderer(renderer);
+    }
+};
+
+} // namespace
+
+namespace sdl3
+{
+
+RenderSurface::RenderSurface(const Vector2i &size)
+{
+    void(create(size));
+}
+
+RenderSurface::~RenderSurface()
+{
+    close();
+}
+
+bool RenderSurface::create(const Vector2i &size)
+{
+    close();
+
+    SDL_Surface *surface = SDL_CreateSurface(size.x, size.y, SDL_PIXELFORMAT_RGBA32);
+    if (!surface)
+    {
+        SDL_Log("%s", SDL_GetError());
+        return false;
+    }
+    surface_.reset(surface, SurfaceDeleter{});
+
+    SDL_Renderer *renderer = SDL_CreateSoftwareRenderer(surface);
+    if (!renderer)
+    {
+        SDL_Log("%s", SDL_GetError());
+        surface_.reset();
+        return false;
+    }
+    // Рендер держит поверхность: она не должна умереть раньше него
+    renderer_.reset(renderer, [surface = surface_](SDL_Renderer *r) { SurfaceDeleter{}(r); });
+
+    subscribe();
+    view_.setCenterPosition({size.x / 2.f, size.y / 2.f});
+    return true;
+}
+
+void RenderSurface::close()
+{
+    setThreadedRendering(false);
+    discardBatch();
+    unsubscribe();
+    view_.reset();
+    renderer_.reset();
+    surface_.reset();
+}
+
+bool RenderSurface::isCreated() const
+{
+    return static_cast<bool>(renderer_);
+}
+
+std::size_t RenderSurface::getRendererID() const
+{
+    return rendererId_;
+}
+
+Vector2i RenderSurface::getSize() const
+{
+    return surface_ ? Vector2i{surface_->w, surface_->h} : Vector2i{};
+}
+
+bool RenderSurface::readPixels(const IntRect &rect, Image &image)
+{
+    if (!surface_)
+        return false;
+
+    // Дожидается очереди и сбрасывает пакет, затем SDL доводит свои команды до поверхности
+    const std::shared_ptr<SDL_Renderer> renderer = getNativeSDLRenderer();
+    auto lock = lockRenderer();
+    if (!SDL_FlushRenderer(renderer.get()))
+    {
+        SDL_Log("%s", SDL_GetError());
+        return false;
+    }
+
+    const int x0 = std::clamp(rect.x, 0, surface_->w);
+    const int y0 = std::clamp(rect.y, 0, surface_->h);
+    const int x1 = std::clamp(rect.x + rect.w, 0, surface_->w);
+    const int y1 = std::clamp(rect.y + rect.h, 0, surface_->h);
+    if (x1 <= x0 || y1 <= y0)
+    {
+        image.clear();
+        return false;
+    }
+
+    const Vector2i size = {x1 - x0, y1 - y0};
+    if (image.getSize() != size)
+        image.create(size);
+
+    // Поверхность уже в RGBA32: построчное копирование без преобразования формата
+    if (!SDL_LockSurface(surface_.get()))
+    {
+        SDL_Log("%s", SDL_GetError());
+        return false;
+    }
+    const std::size_t rowBytes = image.getPitch();
+    const auto *src = static_cast<const std::uint8_t *>(surface_->pixels) +
+                      static_cast<std::size_t>(y0) * static_cast<std::size_t>(surface_->pitch) +
+                      static_cast<std::size_t>(x0) * Image::bytesPerPixel;
+    std::uint8_t *dst = image.getPixels();
+    for (int y = 0; y < size.y; ++y)
+    {
+        std::memcpy(dst, src, rowBytes);
+        src += surface_->pitch;
+        dst += rowBytes;
+    }
+    SDL_UnlockSurface(surface_.get());
+    return true;
+}
+
+std::shared_ptr<SDL_Surface> RenderSurface::getNativeSDLSurface()
+{
+    return surface_;
+}
+
+void RenderSurface::subscribe()
+{
+    rendererId_ = detail::RendererRegistry::subscribeRenderer(renderer_, rendererMtx_);
+}
+
+void RenderSurface::unsubscribe()
+{
+    detail::RendererRegistry::unsubscribeRenderer(rendererId_);
+    rendererId_ = detail::RendererRegistry::invalidID;
+}
+
+} // namespace sdl3
@@ -5,16 +5,29 @@
 #include <SDL3/SDL_log.h>
 #include <SDL3/SDL_render.h>
 
+#include <SDL_wrapper/Core/ThreadPool.hpp>
+#include <SDL_wrapper/Graphics/Renders/FrameCapture.hpp>
 #include <SDL_wrapper/Graphics/ObjectBase/Drawable.hpp>
 #include <SDL_wrapper/Graphics/Texture.hpp>
 
-SDL_Texture *getRawTextureFromTexture(const sdl3::Texture *texture)
+namespace
 {
-    if (texture)
-        return const_cast<SDL_Texture *>(texture->getSDLTexture().lock().get());
-    return nullptr;
+
+// Цвет на вершину, если он задан, иначе один цвет на весь вызов
+template <typename Container>
+void appendColors(Container &out, const sdl3::Color *colors, const int count, const SDL_FColor &uniform)
+{
+    if (!colors)
+    {
+        out.insert(out.end(), static_cast<std::size_t>(count), uniform);
+        return;
+    }
+    for (int i = 0; i < count; ++i)
+        out.push_back({colors[i].r, colors[i].g, colors[i].b, colors[i].a});
 }
 
+} // namespace
+
 namespace sdl3
 {
 
@@ -27,21 +40,182 @@ void RenderTarget::draw(const Drawable* object)
     object->draw(*this);
 }
 
+void RenderTarget::prepare(std::span<const Drawable *const> objects)
+{
+    const RenderContext context = getRenderContext();
+    for (const Drawable *object : objects)
+        object->prepare(context);
+}
+
+void RenderTarget::prepare(std::span<const Drawable *const> objects, ThreadPool &pool)
+{
+    // Контекст считается здесь: View кэширует матрицу лениво и не должен трогаться из потоков пула
+    const RenderContext context = getRenderContext();
+
+    // Подготовка одного объекта дешёвая, поэтому куски берутся крупные
+    constexpr std::size_t grain = 64;
+    pool.parallelFor(objects.size(), [&](const std::size_t begin, const std::size_t end)
+    {
+        for (std::size_t i = begin; i < end; ++i)
+            objects[i]->prepare(context);
+    }, grain);
+}
+
+void RenderTarget::submit(std::span<const Drawable *const> objects)
+{
+    for (const Drawable *object : objects)
+        object->draw(*this);
+}
+
 void RenderTarget::drawShape(const Texture *texture,
                              const Vector2f *positions, const int posCnt,
                              const Vector2f *uv, const int /*uvCnt*/,
                              const Color &color,
-                             const int *indices, const int indCnt)
+                             const int *indices, const int indCnt,
+                             const int textureLevel)
+{
+    appendGeometry(texture, textureLevel, positions, posCnt, uv, nullptr, color, indices, indCnt);
+}
+
+void RenderTarget::drawGeometry(const Texture *texture,
+                                const Vector2f *positions, const Color *colors, const Vector2f *uv, const int vertexCount,
+                                const int *indices, const int indexCount)
+{
+    appendGeometry(texture, 0, positions, vertexCount, uv, colors, Colors::White, indices, indexCount);
+}
+
+void RenderTarget::appendGeometry(const Texture *texture, const int textureLevel,
+                                  const Vector2f *positions, const int posCnt,
+                                  const Vector2f *uv, const Color *vertexColors, const Color &color,
+                                  const int *indices, const int indCnt)
 {
     if (!renderer_ || !posCnt)
         return;
-    SDL_Texture *sdlTex = getRawTextureFromTexture(texture);
-    SDL_RenderGeometryRaw(renderer_.get(), sdlTex,
-                          &positions->x, sizeof(Vector2f),
-                          reinterpret_cast<const SDL_FColor*>(&color), 0,
-                          uv ? &uv->x : nullptr, sizeof(Vector2f),
-                          posCnt,
-                          indices, indCnt, sizeof(int));
+    const TextureHandle handle = texture ? texture->getHandle(rendererId_, textureLevel) : TextureHandle{};
+    SDL_Texture *sdlTex = handle.native;
+    const SDL_FColor fcolor = {color.r, color.g, color.b, color.a};
+
+    if (queue_)
+    {
+        recordShape(texture, textureLevel, sdlTex, positions, posCnt, uv, vertexColors, fcolor, indices, indCnt);
+        return;
+    }
+
+    if (sdlTex != batch_.texture)
+    {
+        flushBatch();
+        batch_.texture = sdlTex;
+        // Текстуру могут уничтожить или перезагрузить до сброса пачки: ссылка берётся раз на смену текстуры
+        if (sdlTex)
+            batch_.textureRef = std::const_pointer_cast<SDL_Texture>(texture->getSDLTexture(rendererId_, textureLevel).lock());
+    }
+
+    const int base = static_cast<int>(batch_.positions.size());
+
+    batch_.positions.insert(batch_.positions.end(), positions, positions + posCnt);
+    appendColors(batch_.colors, vertexColors, posCnt, fcolor);
+    if (sdlTex)
+    {
+        if (uv)
+            batch_.uv.insert(batch_.uv.end(), uv, uv + posCnt);
+        else
+            batch_.uv.insert(batch_.uv.end(), static_cast<std::size_t>(posCnt), Vector2f{});
+    }
+
+    if (indices)
+    {
+        for (int i = 0; i < indCnt; ++i)
+            batch_.indices.push_back(base + indices[i]);
+    }
+    else
+    {
+        for (int i = 0; i < posCnt; ++i)
+            batch_.indices.push_back(base + i);
+    }
+}
+
+void RenderTarget::recordShape(const Texture *texture, const int textureLevel, SDL_Texture *sdlTex,
+                               const Vector2f *positions, const int posCnt,
+                               const Vector2f *uv,
+                               const Color *vertexColors, const SDL_FColor &color,
+                               const int *indices, const int indCnt)
+{
+    using detail::RenderCommand;
+
+    detail::CommandList &list = queue_->recording();
+
+    const bool sameTexture = !list.commands.empty() &&
+                             list.commands.back().type == RenderCommand::Type::Geometry &&
+                             (list.commands.back().texture < 0
+                                  ? sdlTex == nullptr
+                                  : list.textures[static_cast<std::size_t>(list.commands.back().texture)].get() == sdlTex);
+    if (!sameTexture)
+    {
+        RenderCommand cmd;
+        cmd.type = RenderCommand::Type::Geometry;
+        cmd.firstVertex = static_cast<int>(list.positions.size());
+        cmd.firstIndex = static_cast<int>(list.indices.size());
+        if (sdlTex)
+        {
+            // Ссылка держит текстуру живой до конца воспроизведения кадра
+            if (list.textures.empty() || list.textures.back().get() != sdlTex)
+                list.textures.push_back(std::const_pointer_cast<SDL_Texture>(texture->getSDLTexture(rendererId_, textureLevel).lock()));
+            cmd.texture = static_cast<int>(list.textures.size()) - 1;
+        }
+        list.commands.push_back(cmd);
+    }
+
+    RenderCommand &cmd = list.commands.back();
+    const int base = cmd.vertexCount;
+
+    list.positions.insert(list.positions.end(), positions, positions + posCnt);
+    appendColors(list.colors, vertexColors, posCnt, color);
+    // UV пишутся для всех вершин, чтобы диапазон команды был общим для всех массивов
+    if (sdlTex && uv)
+        list.uv.insert(list.uv.end(), uv, uv + posCnt);
+    else
+        list.uv.insert(list.uv.end(), static_cast<std::size_t>(posCnt), Vector2f{});
+
+    if (indices)
+    {
+        for (int i = 0; i < indCnt; ++i)
+            list.indices.push_back(base + indices[i]);
+        cmd.indexCount += indCnt;
+    }
+    else
+    {
+        for (int i = 0; i < posCnt; ++i)
+            list.indices.push_back(base + i);
+        cmd.indexCount += posCnt;
+    }
+    cmd.vertexCount += posCnt;
+}
+
+void RenderTarget::flushBatch()
+{
+    if (batch_.positions.empty())
+        return;
+
+    if (renderer_)
+    {
+        SDL_RenderGeometryRaw(renderer_.get(), batch_.texture,
+                              &batch_.positions.data()->x, sizeof(Vector2f),
+                              batch_.colors.data(), sizeof(SDL_FColor),
+                              batch_.texture ? &batch_.uv.data()->x : nullptr, sizeof(Vector2f),
+                              static_cast<int>(batch_.positions.size()),
+                              batch_.indices.data(), static_cast<int>(batch_.indices.size()), sizeof(int));
+    }
+    discardBatch();
+}
+
+void RenderTarget::discardBatch()
+{
+    batch_.texture = nullptr;
+    batch_.textureRef.reset();
+    batch_.positions.clear();
+    batch_.colors.clear();
+    batch_.uv.clear();
+    batch_.indices.clear();
 }
 
 const View &RenderTarget::getView() const
@@ -64,39 +238,186 @@ unsigned RenderTarget::getViewId() const
 }
 
 Vector2f RenderTarget::getTargetCenter() const
+{
+    if (queue_)
+        return queue_->getTargetCenter();
+    return detail::RenderQueue::queryTargetCenter(renderer_.get());
+}
+
+RenderContext RenderTarget::getRenderContext() const
+{
+    RenderContext context;
+    context.viewMatrix = view_.getTransformMatrix();
+    const Vector2f screenCenter = getTargetCenter();
+    context.viewMatrix.tx += screenCenter.x;
+    context.viewMatrix.ty += screenCenter.y;
+    context.viewId = viewId_;
+    return context;
+}
+
+void RenderTarget::clear(const Color &color)
+{
+    discardBatch();
+    if (queue_)
+    {
+        // Всё записанное до очистки всё равно будет затёрто
+        detail::CommandList &list = queue_->recording();
+        list.clear();
+
+        detail::RenderCommand cmd;
+        cmd.type = detail::RenderCommand::Type::Clear;
+        cmd.color = {color.r, color.g, color.b, color.a};
+        list.commands.push_back(cmd);
+        return;
+    }
+    SDL_SetRenderDrawColorFloat(renderer_.get(), color.r, color.g, color.b, color.a);
+    SDL_RenderClear(renderer_.get());
+}
+
+void RenderTarget::display()
+{
+    if (queue_)
+        queue_->submitFrame();
+    else
+    {
+        flushBatch();
+        // После показа содержимое заднего буфера не определено: снимаем до него
+        if (capture_ && capture_->wantsFrame())
+            capture_->captureFrame(*this);
+        SDL_RenderPresent(renderer_.get());
+    }
+    rewindFrameArena();
+    frameLimiter_.wait();
+}
+
+bool RenderTarget::readPixels(const IntRect &rect, Image &image)
 {
     if (!renderer_)
-        return Vector2f{0.0f, 0.0f};
+        return false;
+    if (queue_)
+        queue_->waitIdle();
+    flushBatch();
 
-    int logicalW = 0;
-    int logicalH = 0;
-    SDL_RendererLogicalPresentation logicalMode = SDL_LOGICAL_PRESENTATION_DISABLED;
-    if (SDL_GetRenderLogicalPresentation(renderer_.get(), &logicalW, &logicalH, &logicalMode) &&
-        logicalMode != SDL_LOGICAL_PRESENTATION_DISABLED &&
-        logicalW > 0 && logicalH > 0)
+    auto lock = lockRenderer();
+    const SDL_Rect sdlRect = {rect.x, rect.y, rect.w, rect.h};
+    SDL_Surface *surface = SDL_RenderReadPixels(renderer_.get(), &sdlRect);
+    if (!surface)
     {
-        // При включённом logical presentation координатная система рендера становится "логической",
-        // поэтому центр должен быть в логических единицах, а не в пикселях реального output-size.
-        return Vector2f{logicalW / 2.0f, logicalH / 2.0f};
+        SDL_Log("%s", SDL_GetError());
+        return false;
     }
 
-    int w = 0;
-    int h = 0;
-    if (!SDL_GetCurrentRenderOutputSize(renderer_.get(), &w, &h))
+    const Vector2i size = {surface->w, surface->h};
+    if (image.getSize() != size)
+        image.create(size);
+
+    // Преобразование формата сразу в буфер изображения, без промежуточной поверхности
+    const bool res = SDL_ConvertPixels(size.x, size.y, surface->format, surface->pixels, surface->pitch,
+                                       SDL_PIXELFORMAT_RGBA32, image.getPixels(), static_cast<int>(image.getPitch()));
+    if (!res)
         SDL_Log("%s", SDL_GetError());
+    SDL_DestroySurface(surface);
+    return res;
+}
 
-    return Vector2f{w / 2.0f, h / 2.0f};
+bool RenderTarget::readPixels(Image &image)
+{
+    Vector2i size{};
+    {
+        auto lock = lockRenderer();
+        if (!renderer_ || !SDL_GetRenderOutputSize(renderer_.get(), &size.x, &size.y))
+            return false;
+    }
+    return readPixels({0, 0, size.x, size.y}, image);
 }
 
-void RenderTarget::clear(const Color &color)
+Image RenderTarget::readPixels(const IntRect &rect)
 {
-    SDL_SetRenderDrawColorFloat(renderer_.get(), color.r, color.g, color.b, color.a);
-    SDL_RenderClear(renderer_.get());
+    Image image;
+    void(readPixels(rect, image));
+    return image;
 }
 
-void RenderTarget::display()
+Image RenderTarget::readPixels()
+{
+    Image image;
+    void(readPixels(image));
+    return image;
+}
+
+void RenderTarget::setFrameCapture(FrameCapture *capture)
+{
+    capture_ = capture;
+}
+
+FrameCapture *RenderTarget::getFrameCapture() const
+{
+    return capture_;
+}
+
+void RenderTarget::setFramerateLimit(const double framerate)
+{
+    frameLimiter_.setFramerateLimit(framerate);
+}
+
+const FrameLimiter &RenderTarget::getFrameLimiter() const
+{
+    return frameLimiter_;
+}
+
+FrameLimiter &RenderTarget::getFrameLimiter()
+{
+    return frameLimiter_;
+}
+
+FrameArena &RenderTarget::getFrameArena()
+{
+    return frameArena_;
+}
+
+void RenderTarget::rewindFrameArena()
+{
+    const std::size_t vertexCap = batch_.positions.capacity();
+    const std::size_t uvCap = batch_.uv.capacity();
+    const std::size_t indexCap = batch_.indices.capacity();
+
+    batch_ = GeometryBatch(&frameArena_);
+    frameArena_.reset();
+
+    // Ёмкость прошлого кадра сразу: арена уже слита в один блок, вектора не растут удвоением
+    batch_.positions.reserve(vertexCap);
+    batch_.colors.reserve(vertexCap);
+    batch_.uv.reserve(uvCap);
+    batch_.indices.reserve(indexCap);
+}
+
+void RenderTarget::setThreadedRendering(const bool enable)
+{
+    if (enable == static_cast<bool>(queue_))
+        return;
+
+    if (enable)
+    {
+        if (!renderer_)
+            return;
+        flushBatch();
+        queue_ = std::make_unique<detail::RenderQueue>(renderer_, rendererMtx_);
+    }
+    else
+    {
+        // Дожидается показа отданного кадра; записанное, но не отданное, отбрасывается
+        queue_.reset();
+    }
+}
+
+bool RenderTarget::isThreadedRendering() const
+{
+    return static_cast<bool>(queue_);
+}
+
+std::unique_lock<std::recursive_mutex> RenderTarget::lockRenderer() const
 {
-    SDL_RenderPresent(renderer_.get());
+    return std::unique_lock(*rendererMtx_);
 }
 
 void RenderTarget::setBaseViewPosition(const Vector2f &pos)
@@ -106,6 +427,9 @@ void RenderTarget::setBaseViewPosition(const Vector2f &pos)
 
 std::shared_ptr<SDL_Renderer> RenderTarget::getNativeSDLRenderer()
 {
+    if (queue_)
+        queue_->waitIdle();
+    flushBatch();
     return renderer_;
 }
 
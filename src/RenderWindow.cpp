@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <SDL3/SDL_error.h>
 #include <SDL3/SDL_log.h>
 #include <SDL3/SDL_render.h>
@@ -47,6 +49,8 @@ bool RenderWindow::create(const std::string_view name, const VideoMode &mode)
 
     window_.reset(wnd, Deleterer{});
     renderer_.reset(rnd, Deleterer{});
+    void(setVSync(VideoMode::makeVSyncInterval(mode)));
+    density_->store(std::max(getDisplayScale(), 1.f), std::memory_order_relaxed);
 
     subscribe();
     isFullScreen_ = mode.fullscreen;
@@ -57,6 +61,8 @@ bool RenderWindow::create(const std::string_view name, const VideoMode &mode)
 
 void RenderWindow::close()
 {
+    setThreadedRendering(false);
+    discardBatch();
     unsubscribe();
     view_.reset();
     renderer_.reset();
@@ -66,7 +72,7 @@ void RenderWindow::close()
 
 std::size_t RenderWindow::getWindowID() const
 {
-    return windowID_;
+    return rendererId_;
 }
 
 bool RenderWindow::isOpen()
@@ -85,6 +91,28 @@ void RenderWindow::setFullScreen(const bool isFull)
     SDL_SetWindowFullscreen(window_.get(), isFull);
 }
 
+bool RenderWindow::setVSync(const int interval)
+{
+    if (!renderer_)
+        return false;
+    auto lock = lockRenderer();
+    if (SDL_SetRenderVSync(renderer_.get(), interval))
+        return true;
+    SDL_Log("SDL_SetRenderVSync(%d) failed: %s", interval, SDL_GetError());
+    return interval == SDL_RENDERER_VSYNC_ADAPTIVE && SDL_SetRenderVSync(renderer_.get(), 1);
+}
+
+int RenderWindow::getVSync() const
+{
+    int interval = SDL_RENDERER_VSYNC_DISABLED;
+    if (renderer_)
+    {
+        auto lock = lockRenderer();
+        SDL_GetRenderVSync(renderer_.get(), &interval);
+    }
+    return interval;
+}
+
 bool RenderWindow::loadIconFromFile(const std::string_view iconFileName)
 {
     if (!isOpen_)
@@ -110,6 +138,7 @@ bool RenderWindow::setLogicalPresentation(const Vector2i &requestedSize, const S
     const Vector2f relativeCenter = {oldCenter.x / oldSize.x, oldCenter.y / oldSize.y};
     const Vector2f newCenter = {relativeCenter.x * newSize.x, relativeCenter.y * newSize.y};
 
+    auto lock = lockRenderer();
     if (!SDL_SetRenderLogicalPresentation(renderer_.get(), requestedSize.x, requestedSize.y, mode))
     {
         SDL_Log("SDL_SetRenderLogicalPresentation failed: %s", SDL_GetError());
@@ -132,20 +161,41 @@ float RenderWindow::getPixelDensity() const
     return density;
 }
 
+float RenderWindow::getAssetDensity() const
+{
+    return density_->load(std::memory_order_relaxed);
+}
+
+void RenderWindow::updateDensity(const std::span<const SDL_Event> events)
+{
+    const SDL_WindowID ownID = SDL_GetWindowID(window_.get());
+    for (const SDL_Event &event : events)
+    {
+        if (event.type != SDL_EVENT_WINDOW_DISPLAY_SCALE_CHANGED && event.type != SDL_EVENT_WINDOW_DISPLAY_CHANGED)
+            continue;
+        if (event.window.windowID != ownID)
+            continue;
+        // Окно без масштаба (0 при ошибке) не должно выбирать ресурсы ниже @1x
+        density_->store(std::max(getDisplayScale(), 1.f), std::memory_order_relaxed);
+        return;
+    }
+}
+
 void RenderWindow::subscribe()
 {
-    windowID_ = detail::RendererRegistry::subscribeRenderer(renderer_);
+    rendererId_ = detail::RendererRegistry::subscribeRenderer(renderer_, rendererMtx_, density_);
 }
 
 void RenderWindow::unsubscribe()
 {
-    detail::RendererRegistry::unsubscribeRenderer(windowID_);
-    windowID_ = detail::RendererRegistry::invalidID;
+    detail::RendererRegistry::unsubscribeRenderer(rendererId_);
+    rendererId_ = detail::RendererRegistry::invalidID;
 }
 
 Vector2i RenderWindow::getSize() const
 {
     Vector2i size{};
+    auto lock = lockRenderer();
     if (!SDL_GetRenderOutputSize(renderer_.get(), &size.x, &size.y))
         SDL_Log("%s", SDL_GetError());
     return size;
@@ -155,6 +205,7 @@ Vector2i RenderWindow::getLogicSize() const
 {
     Vector2i size{};
     SDL_RendererLogicalPresentation mode = SDL_LOGICAL_PRESENTATION_DISABLED;
+    auto lock = lockRenderer();
     if (!SDL_GetRenderLogicalPresentation(renderer_.get(), &size.x, &size.y, &mode))
     {
         SDL_Log("%s", SDL_GetError());
@@ -173,6 +224,7 @@ std::shared_ptr<SDL_Window> RenderWindow::getNativeSDLWindow()
 
 void RenderWindow::convertEventToRenderCoordinates(SDL_Event *event) const
 {
+    auto lock = lockRenderer();
     if (!SDL_ConvertEventToRenderCoordinates(const_cast<SDL_Renderer *>(renderer_.get()), event))
         SDL_Log("%s", SDL_GetError());
 }
@@ -182,67 +234,186 @@ void RenderWindow::convertEventToViewCoordinates(SDL_Event *event) const
     if (!event)
         return;
 
-    const Vector2f screenCenter = getTargetCenter();
-    // convertEventToRenderCoordinates(event);
-
-    Matrix3x3<float> worldToScreen = getView().getTransformMatrix();
-    worldToScreen.tx += screenCenter.x;
-    worldToScreen.ty += screenCenter.y;
+    if (const Matrix3x3<float> *screenToView = getScreenToViewMatrix())
+        transformEventInPlace(*event, *screenToView);
+}
 
-    Matrix3x3<float> screenToWorld;
-    if (!worldToScreen.tryInverse(screenToWorld))
+void RenderWindow::convertEventsToViewCoordinates(std::span<SDL_Event> events) const
+{
+    const Matrix3x3<float> *screenToView = getScreenToViewMatrix();
+    if (!screenToView)
         return;
 
+    const SDL_WindowID ownID = window_ ? SDL_GetWindowID(window_.get()) : 0;
+    for (SDL_Event &event : events)
+    {
+        // События других окон в пачке не трогаем: у них свой вид
+        const SDL_WindowID eventID = getEventWindowID(event);
+        if (eventID != 0 && eventID != ownID)
+            continue;
+        transformEventInPlace(event, *screenToView);
+    }
+}
+
+std::span<SDL_Event> RenderWindow::pollEvents(const bool convertToView)
+{
+    constexpr int chunk = 64;
+
+    SDL_PumpEvents();
+
+    std::size_t count = 0;
+    while (true)
+    {
+        if (eventBuffer_.size() < count + chunk)
+            eventBuffer_.resize(count + chunk);
+
+        const int got = SDL_PeepEvents(eventBuffer_.data() + count, chunk, SDL_GETEVENT, SDL_EVENT_FIRST, SDL_EVENT_LAST);
+        if (got < 0)
+            SDL_Log("%s", SDL_GetError());
+        if (got <= 0)
+            break;
+
+        count += static_cast<std::size_t>(got);
+        if (got < chunk)
+            break;
+    }
+
+    std::span<SDL_Event> events(eventBuffer_.data(), count);
+    if (window_)
+        updateDensity(events);
+    if (convertToView)
+        convertEventsToViewCoordinates(events);
+
+    // Очередь SDL общая для всех окон: события ввода чужих окон в их координатах в снимок не попадают
+    inputState_.beginFrame();
+    const SDL_WindowID ownID = SDL_GetWindowID(window_.get());
+    for (const SDL_Event &event : events)
+    {
+        const SDL_WindowID eventID = getEventWindowID(event);
+        if (eventID == 0 || eventID == ownID)
+            inputState_.processEvent(event);
+    }
+    if (publishInput_)
+    {
+        inputSnapshots_->write() = inputState_;
+        inputSnapshots_->publish();
+    }
+
+    // После перевода координат, чтобы точки пути были в координатах вида
+    if (coalesceMotion_)
+        events = motionCoalescer_.coalesce(events);
+    return events;
+}
+
+void RenderWindow::setMotionCoalescing(const bool enabled)
+{
+    coalesceMotion_ = enabled;
+}
+
+bool RenderWindow::isMotionCoalescing() const
+{
+    return coalesceMotion_;
+}
+
+MotionCoalescer &RenderWindow::getMotionCoalescer()
+{
+    return motionCoalescer_;
+}
+
+const MotionCoalescer &RenderWindow::getMotionCoalescer() const
+{
+    return motionCoalescer_;
+}
+
+const InputState &RenderWindow::getInputState() const
+{
+    return inputState_;
+}
+
+void RenderWindow::setInputSnapshotPublishing(const bool enabled)
+{
+    publishInput_ = enabled;
+    if (enabled)
+        getInputSnapshots();
+}
+
+TripleBuffer<InputState> &RenderWindow::getInputSnapshots()
+{
+    // Буфер создаётся по запросу: три копии битовых масок не нужны окнам без второго потока
+    if (!inputSnapshots_)
+        inputSnapshots_ = std::make_unique<TripleBuffer<InputState>>();
+    return *inputSnapshots_;
+}
+
+const Matrix3x3<float> *RenderWindow::getScreenToViewMatrix() const
+{
+    // Обратная матрица зависит только от вида и центра цели: пересчёт лишь при их смене
+    const Vector2f screenCenter = getTargetCenter();
+    if (inverseViewId_ != viewId_ || inverseCenter_.x != screenCenter.x || inverseCenter_.y != screenCenter.y)
+    {
+        Matrix3x3<float> worldToScreen = getView().getTransformMatrix();
+        worldToScreen.tx += screenCenter.x;
+        worldToScreen.ty += screenCenter.y;
+
+        inverseValid_ = worldToScreen.tryInverse(screenToView_);
+        inverseViewId_ = viewId_;
+        inverseCenter_ = screenCenter;
+    }
+    return inverseValid_ ? &screenToView_ : nullptr;
+}
+
+void RenderWindow::transformEventInPlace(SDL_Event &event, const Matrix3x3<float> &screenToView)
+{
     auto transformPointInPlace = [&](float &x, float &y)
     {
-        const Vector2f out = screenToWorld.transform({x, y});
+        const Vector2f out = screenToView.transform({x, y});
         x = out.x;
         y = out.y;
     };
 
     auto transformDeltaInPlace = [&](float &x, float &y)
     {
-        const Vector2f out = screenToWorld.transformVector({x, y});
+        const Vector2f out = screenToView.transformVector({x, y});
         x = out.x;
         y = out.y;
     };
 
-    switch (event->type)
+    switch (event.type)
     {
     case SDL_EVENT_MOUSE_MOTION:
-        transformPointInPlace(event->motion.x, event->motion.y);
-        transformDeltaInPlace(event->motion.xrel, event->motion.yrel);
+        transformPointInPlace(event.motion.x, event.motion.y);
+        transformDeltaInPlace(event.motion.xrel, event.motion.yrel);
         break;
 
     case SDL_EVENT_MOUSE_BUTTON_DOWN:
     case SDL_EVENT_MOUSE_BUTTON_UP:
-        transformPointInPlace(event->button.x, event->button.y);
+        transformPointInPlace(event.button.x, event.button.y);
         break;
 
     case SDL_EVENT_FINGER_DOWN:
     case SDL_EVENT_FINGER_UP:
     case SDL_EVENT_FINGER_MOTION:
     case SDL_EVENT_FINGER_CANCELED:
-        transformPointInPlace(event->tfinger.x, event->tfinger.y);
-        transformDeltaInPlace(event->tfinger.dx, event->tfinger.dy);
+        transformPointInPlace(event.tfinger.x, event.tfinger.y);
+        transformDeltaInPlace(event.tfinger.dx, event.tfinger.dy);
         break;
 
     case SDL_EVENT_PEN_MOTION:
-        transformPointInPlace(event->pmotion.x, event->pmotion.y);
+        transformPointInPlace(event.pmotion.x, event.pmotion.y);
         break;
 
     case SDL_EVENT_PEN_DOWN:
     case SDL_EVENT_PEN_UP:
-        transformPointInPlace(event->ptouch.x, event->ptouch.y);
+        transformPointInPlace(event.ptouch.x, event.ptouch.y);
         break;
 
     case SDL_EVENT_PEN_BUTTON_DOWN:
     case SDL_EVENT_PEN_BUTTON_UP:
-        transformPointInPlace(event->pbutton.x, event->pbutton.y);
+        transformPointInPlace(event.pbutton.x, event.pbutton.y);
         break;
 
     case SDL_EVENT_PEN_AXIS:
-        transformPointInPlace(event->paxis.x, event->paxis.y);
+        transformPointInPlace(event.paxis.x, event.paxis.y);
         break;
 
     default:
@@ -250,4 +421,38 @@ void RenderWindow::convertEventToViewCoordinates(SDL_Event *event) const
     }
 }
 
+SDL_WindowID RenderWindow::getEventWindowID(const SDL_Event &event)
+{
+    switch (event.type)
+    {
+    case SDL_EVENT_KEY_DOWN:
+    case SDL_EVENT_KEY_UP:
+        return event.key.windowID;
+    case SDL_EVENT_MOUSE_MOTION:
+        return event.motion.windowID;
+    case SDL_EVENT_MOUSE_BUTTON_DOWN:
+    case SDL_EVENT_MOUSE_BUTTON_UP:
+        return event.button.windowID;
+    case SDL_EVENT_MOUSE_WHEEL:
+        return event.wheel.windowID;
+    case SDL_EVENT_FINGER_DOWN:
+    case SDL_EVENT_FINGER_UP:
+    case SDL_EVENT_FINGER_MOTION:
+    case SDL_EVENT_FINGER_CANCELED:
+        return event.tfinger.windowID;
+    case SDL_EVENT_PEN_MOTION:
+        return event.pmotion.windowID;
+    case SDL_EVENT_PEN_DOWN:
+    case SDL_EVENT_PEN_UP:
+        return event.ptouch.windowID;
+    case SDL_EVENT_PEN_BUTTON_DOWN:
+    case SDL_EVENT_PEN_BUTTON_UP:
+        return event.pbutton.windowID;
+    case SDL_EVENT_PEN_AXIS:
+        return event.paxis.windowID;
+    default:
+        return 0;
+    }
+}
+
 } // namespace sdl3
@@ -1,28 +1,24 @@
 #include <SDL_wrapper/Graphics/Detail/RendererRegistry.hpp>
+#include <SDL_wrapper/Graphics/Texture.hpp>
 
 namespace sdl3::detail
 {
 
-RendererRegistry::Storage* RendererRegistry::storageOrNull_NoInit() noexcept
+RendererRegistry::Storage &RendererRegistry::storage()
 {
-    return s_;
+    // Не разрушается: окна со статическим временем жизни могут отписываться после выхода из main
+    static Storage *s = new Storage();
+    return *s;
 }
 
-std::size_t RendererRegistry::subscribeRenderer(std::shared_ptr<SDL_Renderer> renderer)
+std::size_t RendererRegistry::subscribeRenderer(std::shared_ptr<SDL_Renderer> renderer,
+                                                std::shared_ptr<std::recursive_mutex> rendererMtx,
+                                                std::shared_ptr<std::atomic<float>> density)
 {
     if (!renderer)
         return invalidID;
 
-    if (!s_)
-        s_ = new Storage();
-
-    std::lock_guard lk(s_->mtx);
-
-    const auto id = s_->nextRendererId++;
-    s_->renderers[id] = std::move(renderer);
-    ++s_->usersCount;
-
-    return id;
+    return storage().insert(Entry{std::move(renderer), std::move(rendererMtx), std::move(density)});
 }
 
 void RendererRegistry::unsubscribeRenderer(std::size_t id) noexcept
@@ -30,49 +26,30 @@ void RendererRegistry::unsubscribeRenderer(std::size_t id) noexcept
     if (id == invalidID)
         return;
 
-    auto* st = storageOrNull_NoInit();
-
-    if (!st)
-        return;
-
-    bool needDelete = false;
-
-    {
-        std::lock_guard lk(st->mtx);
-
-        const auto erased = st->renderers.erase(id);
-        if (erased != 0 && st->usersCount > 0)
-            --st->usersCount;
-
-        if (st->usersCount == 0)
-        {
-            st->renderers.clear();
-            st->nextRendererId = 0;
-            needDelete = true;
-        }
-    }
-
-    if (needDelete)
-    {
-        delete st;
-        s_ = nullptr;
-    }
+    storage().erase(id);
+    Texture::releaseRendererCopies(id);
 }
 
 std::weak_ptr<SDL_Renderer> RendererRegistry::getRenderer(std::size_t id) noexcept
 {
-    auto* st = storageOrNull_NoInit();
-
-    if (!st)
-        return {};
+    return storage().get(id).renderer;
+}
 
-    std::lock_guard lk(st->mtx);
+std::shared_ptr<std::recursive_mutex> RendererRegistry::getRendererMutex(std::size_t id) noexcept
+{
+    return storage().get(id).rendererMtx;
+}
 
-    auto it = st->renderers.find(id);
+float RendererRegistry::getDensity(std::size_t id) noexcept
+{
+    const std::shared_ptr<std::atomic<float>> density = storage().get(id).density;
+    return density ? density->load(std::memory_order_relaxed) : 1.f;
+}
 
-    return it == st->renderers.end()
-               ? std::weak_ptr<SDL_Renderer>{}
-               : it->second;
+std::size_t RendererRegistry::getPrimaryWindow()
+{
+    // Плотность передаёт только RenderWindow
+    return storage().findFirst([](const Entry &entry) { return entry.density != nullptr; });
 }
 
 } // namespace sdl3::detail
@@ -1,10 +1,41 @@
 #include <SDL_wrapper/Graphics/ObjectBase/Shape.hpp>
 
+#include <algorithm>
 #include <cmath>
 
+#include <SDL_wrapper/Core/Math/Triangulation.hpp>
+#include <SDL_wrapper/Core/Math/VectorMath.hpp>
 #include <SDL_wrapper/Graphics/Renders/RenderTarget.hpp>
 #include <SDL_wrapper/Graphics/Texture.hpp>
 
+namespace
+{
+
+using sdl3::Vector2f;
+
+float orient(const Vector2f &a, const Vector2f &b, const Vector2f &p)
+{
+    return (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x);
+}
+
+// Точка на границе считается попавшей; ориентация треугольника не важна
+bool triangleContains(const Vector2f &a, const Vector2f &b, const Vector2f &c, const Vector2f &p)
+{
+    const float d1 = orient(a, b, p);
+    const float d2 = orient(b, c, p);
+    const float d3 = orient(c, a, p);
+    const bool hasNeg = d1 < 0.f || d2 < 0.f || d3 < 0.f;
+    const bool hasPos = d1 > 0.f || d2 > 0.f || d3 > 0.f;
+    return !(hasNeg && hasPos);
+}
+
+bool rectContains(const sdl3::FloatRect &r, const Vector2f &p)
+{
+    return p.x >= r.x && p.x <= r.x + r.w && p.y >= r.y && p.y <= r.y + r.h;
+}
+
+} // namespace
+
 namespace sdl3
 {
 
@@ -46,14 +77,14 @@ void Shape::setOutlineColor(const Color &color)
 void Shape::setOutlineThickness(const float outlineThickness)
 {
     outlineThickness_ = outlineThickness;
-    updateLocalOutline();
+    updateLocalGeometry();
 }
 
 void Shape::setTexture(const Texture &texture, const FloatRect &rect)
 {
     texture_ = &texture;
     textureRect_ = rect;
-    updateTexturePoints();
+    updateLocalGeometry();
 }
 
 void Shape::setTexture(const Texture &texture)
@@ -63,24 +94,96 @@ void Shape::setTexture(const Texture &texture)
     textureRect_.x = textureRect_.y = 0;
     textureRect_.w = static_cast<float>(size.x);
     textureRect_.h = static_cast<float>(size.y);
-    updateTexturePoints();
+    updateLocalGeometry();
 }
 
 void Shape::setTextureRect(const FloatRect &rect)
 {
     textureRect_ = rect;
-    updateTexturePoints();
+    updateLocalGeometry();
+}
+
+FloatRect Shape::getLocalBounds() const
+{
+    return mesh_ ? mesh_->outerBounds : FloatRect{};
+}
+
+FloatRect Shape::getGlobalBounds() const
+{
+    return getTransformMatrix().transformRect(getLocalBounds());
+}
+
+bool Shape::containsPoint(const Vector2f &point) const
+{
+    if (!mesh_)
+        return false;
+
+    Matrix3x3<float> inverse;
+    if (!getTransformMatrix().tryInverse(inverse))
+        return false;
+
+    // Проверка в локальных координатах: сетка разделяемая и уже триангулирована
+    const Vector2f local = inverse.transform(point);
+    if (!rectContains(mesh_->outerBounds, local))
+        return false;
+
+    const std::vector<Vector2f> &vertices = mesh_->vertices;
+    const std::vector<int> &indices = *mesh_->indices;
+    for (std::size_t i = 0; i + 2 < indices.size(); i += 3)
+        if (triangleContains(vertices[indices[i]], vertices[indices[i + 1]], vertices[indices[i + 2]], local))
+            return true;
+
+    const std::vector<Vector2f> &outline = mesh_->outlineVertices;
+    for (std::size_t i = 0; i + 2 < outline.size(); i += 3)
+        if (triangleContains(outline[i], outline[i + 1], outline[i + 2], local))
+            return true;
+
+    return false;
+}
+
+unsigned Shape::getPickVersion() const
+{
+    // Обе версии только растут, поэтому сумма меняется при любом изменении
+    return getVersion() + localVersion_;
 }
 
 void Shape::updateLocalGeometry()
 {
-    updateLocalShape();
-    updateLocalOutline();
+    ++localVersion_;
+    shapeDirty_ = true;
+    outlineDirty_ = true;
+
+    const std::size_t count = getPointCount();
+    if (count < 3)
+    {
+        mesh_.reset();
+        return;
+    }
+
+    detail::ShapeMeshKey key;
+    key.points.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        key.points.push_back(getPoint(i));
+    const auto holes = getLocalHoles();
+    key.holes.assign(holes.begin(), holes.end());
+    key.outlineThickness = outlineThickness_;
+    key.textureRect = textureRect_;
+    key.textureSize = texture_ ? texture_->getSize() : Vector2i{};
+
+    mesh_ = detail::ShapeMeshRegistry::acquire(std::move(key), &Shape::buildLocalMesh, mesh_.get());
 }
 
-void Shape::draw(RenderTarget &target) const
+std::span<const std::vector<Vector2f>> Shape::getLocalHoles() const
+{
+    return {};
+}
+
+void Shape::prepare(const RenderContext &context) const
 {
-    const bool viewDirty = viewID_ != target.getViewId();
+    if (!mesh_)
+        return;
+
+    const bool viewDirty = viewID_ != context.viewId;
     const bool transformDirty = isGeometryDirty();
 
     const bool needFillUpdate = transformDirty || shapeDirty_ || viewDirty;
@@ -88,26 +191,37 @@ void Shape::draw(RenderTarget &target) const
 
     if (needFillUpdate || needOutlineUpdate)
     {
-        Matrix3x3<float> matrix = target.getView().getTransformMatrix() * getTransformMatrix();
-        const Vector2f screenCenter = target.getTargetCenter();
-        matrix.tx += screenCenter.x;
-        matrix.ty += screenCenter.y;
+        const Matrix3x3<float> matrix = context.viewMatrix * getTransformMatrix();
 
         if (needFillUpdate)
             updateVertices(matrix);
         if (needOutlineUpdate)
             updateOutlineVertices(matrix);
 
-        viewID_ = target.getViewId();
+        viewID_ = context.viewId;
 
         updateGeometryVersion();
     }
+}
 
-    target.drawShape(texture_,
-                     vertices_.data(), static_cast<int>(vertices_.size()),
-                     textureUV_.data(), static_cast<int>(textureUV_.size()),
-                     fillColor_,
-                     nullptr, 0);
+void Shape::draw(RenderTarget &target) const
+{
+    if (!mesh_)
+        return;
+
+    // После RenderTarget::prepare кэши актуальны и контекст не запрашивается
+    if (viewID_ != target.getViewId() || isGeometryDirty() || shapeDirty_ || outlineDirty_)
+        prepare(target.getRenderContext());
+
+    if (!mesh_->indices->empty())
+    {
+        target.drawShape(texture_,
+                         vertices_.data(), static_cast<int>(vertices_.size()),
+                         mesh_->textureUV.data(), static_cast<int>(mesh_->textureUV.size()),
+                         fillColor_,
+                         mesh_->indices->data(), static_cast<int>(mesh_->indices->size()),
+                         textureLevel_);
+    }
 
     target.drawShape(nullptr,
                      outlineVertices_.data(), static_cast<int>(outlineVertices_.size()),
@@ -116,140 +230,162 @@ void Shape::draw(RenderTarget &target) const
                      nullptr, 0);
 }
 
-void Shape::updateLocalShape()
+void Shape::buildLocalMesh(detail::ShapeMesh &mesh, const detail::ShapeMesh *previous)
 {
-    size_t count = getPointCount();
-    if (count < 3)
-    {
-        localVertices_.clear();
-        localOutlineVertices_.clear();
-        return;
-    }
+    buildLocalBounds(mesh);
+    buildLocalShape(mesh);
+    buildLocalIndices(mesh, previous);
+    buildLocalOutline(mesh);
+}
 
-    updateLocalBounds();
+void Shape::buildLocalShape(detail::ShapeMesh &mesh)
+{
+    const detail::ShapeMeshKey::Points &points = mesh.key.points;
+    const std::size_t count = points.size();
+    const FloatRect &bounds = mesh.localBounds;
+    const FloatRect &textureRect = mesh.key.textureRect;
 
     float texW = 1.0f;
     float texH = 1.0f;
-    if (texture_)
+    if (mesh.key.textureSize.x != 0 && mesh.key.textureSize.y != 0)
     {
-        Vector2i size = texture_->getSize();
-        texW = static_cast<float>(size.x);
-        texH = static_cast<float>(size.y);
+        texW = static_cast<float>(mesh.key.textureSize.x);
+        texH = static_cast<float>(mesh.key.textureSize.y);
     }
 
-    localVertices_.clear();
-    localVertices_.reserve(count * 3);
-    textureUV_.clear();
-    textureUV_.reserve(count * 3);
+    std::size_t total = count;
+    for (const auto &hole : mesh.key.holes)
+        total += hole.size();
+    mesh.vertices.reserve(total);
+    mesh.textureUV.reserve(total);
 
     auto createUV = [&](Vector2f p) -> Vector2f
     {
         Vector2f uv;
 
-        float ratioX = (localBounds_.w != 0.0f) ? (p.x - localBounds_.x) / localBounds_.w : 0.0f;
-        float ratioY = (localBounds_.h != 0.0f) ? (p.y - localBounds_.y) / localBounds_.h : 0.0f;
+        float ratioX = (bounds.w != 0.0f) ? (p.x - bounds.x) / bounds.w : 0.0f;
+        float ratioY = (bounds.h != 0.0f) ? (p.y - bounds.y) / bounds.h : 0.0f;
 
-        uv.x = (textureRect_.x + ratioX * textureRect_.w) / texW;
-        uv.y = (textureRect_.y + ratioY * textureRect_.h) / texH;
+        uv.x = (textureRect.x + ratioX * textureRect.w) / texW;
+        uv.y = (textureRect.y + ratioY * textureRect.h) / texH;
 
         return uv;
     };
 
-    Vector2f center = {localBounds_.x + localBounds_.w / 2.0f, localBounds_.y + localBounds_.h / 2.0f};
-    Vector2f centerVert = center;
-    Vector2f centerUV = createUV(center);
-
-    for (size_t i = 0; i < count; ++i)
+    // Вершины отверстий идут после внешнего контура - так их нумерует triangulatePolygon
+    auto append = [&](const auto &contour)
     {
-        localVertices_.push_back(centerVert);
-        localVertices_.push_back(getPoint(i));
-        localVertices_.push_back(getPoint((i + 1) % count));
+        for (const auto &p : contour)
+        {
+            mesh.vertices.push_back(p);
+            mesh.textureUV.push_back(createUV(p));
+        }
+    };
 
-        textureUV_.push_back(centerUV);
-        textureUV_.push_back(createUV(getPoint(i)));
-        textureUV_.push_back(createUV(getPoint((i + 1) % count)));
-    }
-    shapeDirty_ = true;
+    append(points);
+    for (const auto &hole : mesh.key.holes)
+        append(hole);
 }
 
-void Shape::updateLocalOutline()
+void Shape::buildLocalIndices(detail::ShapeMesh &mesh, const detail::ShapeMesh *previous)
 {
-    size_t count = getPointCount();
-    if (count < 3)
+    // Смена текстуры или обводки не трогает контуры: триангуляция берётся из прошлой сетки
+    if (previous && previous->indices &&
+        previous->key.points == mesh.key.points && previous->key.holes == mesh.key.holes)
     {
-        localVertices_.clear();
-        localOutlineVertices_.clear();
+        mesh.indices = previous->indices;
+        mesh.convex = previous->convex;
         return;
     }
 
-    auto normalizePoint = [](Vector2f v)
-    {
-        float len = std::sqrt(v.x * v.x + v.y * v.y);
-        return (len > 0) ? Vector2f{v.x / len, v.y / len} : Vector2f{0, 0};
-    };
+    const detail::ShapeMeshKey::Points &points = mesh.key.points;
+    std::vector<int> indices;
 
-    localOutlineVertices_.clear();
-    if (outlineThickness_ != 0)
+    mesh.convex = mesh.key.holes.empty() && isConvexPolygon(points);
+    if (mesh.convex)
     {
-        localOutlineVertices_.reserve(count * 6);
-
-        for (size_t i = 0; i < count; ++i)
+        const int count = static_cast<int>(points.size());
+        indices.reserve(static_cast<std::size_t>(count - 2) * 3);
+        for (int i = 1; i + 1 < count; ++i)
         {
-            Vector2f pPrev = getPoint((i + count - 1) % count);
-            Vector2f pCurr = getPoint(i);
-            Vector2f pNext = getPoint((i + 1) % count);
+            indices.push_back(0);
+            indices.push_back(i);
+            indices.push_back(i + 1);
+        }
+    }
+    else
+        indices = triangulatePolygon(points, mesh.key.holes);
 
-            Vector2f v1 = {pCurr.x - pPrev.x, pCurr.y - pPrev.y};
-            Vector2f v2 = {pNext.x - pCurr.x, pNext.y - pCurr.y};
+    mesh.indices = std::make_shared<const std::vector<int>>(std::move(indices));
+}
 
-            v1 = normalizePoint(v1);
-            v2 = normalizePoint(v2);
+void Shape::buildLocalOutline(detail::ShapeMesh &mesh)
+{
+    const detail::ShapeMeshKey::Points &points = mesh.key.points;
+    const std::size_t count = points.size();
+    const float outlineThickness = mesh.key.outlineThickness;
 
-            Vector2f n1 = {-v1.y, v1.x};
-            Vector2f n2 = {-v2.y, v2.x};
+    mesh.outerBounds = mesh.localBounds;
+    if (outlineThickness == 0)
+        return;
 
-            Vector2f edgeNormal = {n1.x + n2.x, n1.y + n2.y};
-            edgeNormal = normalizePoint(edgeNormal);
+    // Нормаль каждого ребра считается один раз: normals[i] - ребро i -> i + 1
+    SmallVector<Vector2f, 16> normals(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const Vector2f dir = normalize(points[(i + 1) % count] - points[i]);
+        normals[i] = {-dir.y, dir.x};
+    }
 
-            float dot = edgeNormal.x * n1.x + edgeNormal.y * n1.y;
-            float miterLen = (dot > 0.1f) ? (outlineThickness_ / dot) : outlineThickness_;
+    SmallVector<Vector2f, 16> outer(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const Vector2f &n1 = normals[(i + count - 1) % count];
+        const Vector2f &n2 = normals[i];
 
-            Vector2f outer1 = {pCurr.x + edgeNormal.x * miterLen, pCurr.y + edgeNormal.y * miterLen};
-            Vector2f inner1 = pCurr;
+        const Vector2f edgeNormal = normalize(n1 + n2);
+        const float cosHalf = dot(edgeNormal, n1);
+        const float miterLen = (cosHalf > 0.1f) ? (outlineThickness / cosHalf) : outlineThickness;
 
-            size_t nextIdx = (i + 1) % count;
-            Vector2f pNextNext = getPoint((nextIdx + 1) % count);
-            Vector2f v3 = normalizePoint({pNextNext.x - pNext.x, pNextNext.y - pNext.y});
-            Vector2f n3 = {-v3.y, v3.x};
-            Vector2f edgeNormalNext = normalizePoint({n2.x + n3.x, n2.y + n3.y});
-            float dotNext = edgeNormalNext.x * n2.x + edgeNormalNext.y * n2.y;
-            float miterLenNext = (dotNext > 0.1f) ? (outlineThickness_ / dotNext) : outlineThickness_;
+        outer[i] = points[i] + edgeNormal * miterLen;
+    }
 
-            Vector2f outer2 = {pNext.x + edgeNormalNext.x * miterLenNext, pNext.y + edgeNormalNext.y * miterLenNext};
-            Vector2f inner2 = pNext;
+    mesh.outlineVertices.reserve(count * 6);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::size_t next = (i + 1) % count;
 
-            localOutlineVertices_.push_back(inner1);
-            localOutlineVertices_.push_back(outer1);
-            localOutlineVertices_.push_back(outer2);
+        mesh.outlineVertices.push_back(points[i]);
+        mesh.outlineVertices.push_back(outer[i]);
+        mesh.outlineVertices.push_back(outer[next]);
 
-            localOutlineVertices_.push_back(inner1);
-            localOutlineVertices_.push_back(outer2);
-            localOutlineVertices_.push_back(inner2);
-        }
+        mesh.outlineVertices.push_back(points[i]);
+        mesh.outlineVertices.push_back(outer[next]);
+        mesh.outlineVertices.push_back(points[next]);
     }
 
-    outlineDirty_ = true;
+    // Обводка с отрицательной толщиной уходит внутрь, тогда рамка не меняется
+    FloatRect &bounds = mesh.outerBounds;
+    for (const Vector2f &p : outer)
+    {
+        const float right = std::max(bounds.x + bounds.w, p.x);
+        const float bottom = std::max(bounds.y + bounds.h, p.y);
+        bounds.x = std::min(bounds.x, p.x);
+        bounds.y = std::min(bounds.y, p.y);
+        bounds.w = right - bounds.x;
+        bounds.h = bottom - bounds.y;
+    }
 }
 
-void Shape::updateLocalBounds()
+void Shape::buildLocalBounds(detail::ShapeMesh &mesh)
 {
-    Vector2f firstPoint = getPoint(0);
+    const detail::ShapeMeshKey::Points &points = mesh.key.points;
+    Vector2f firstPoint = points[0];
     float minX = firstPoint.x, maxX = firstPoint.x;
     float minY = firstPoint.y, maxY = firstPoint.y;
-    std::size_t count = getPointCount();
-    for (size_t i = 1; i < count; ++i)
+    for (size_t i = 1; i < points.size(); ++i)
     {
-        Vector2f p = getPoint(i);
+        const Vector2f &p = points[i];
         if (p.x < minX)
             minX = p.x;
         if (p.x > maxX)
@@ -259,57 +395,36 @@ void Shape::updateLocalBounds()
         if (p.y > maxY)
             maxY = p.y;
     }
-    localBounds_ = {minX, minY, maxX - minX, maxY - minY};
-}
-
-void Shape::updateTexturePoints()
-{
-    if (localVertices_.empty())
-        return;
-
-    float texW = 1.0f;
-    float texH = 1.0f;
-    if (texture_)
-    {
-        Vector2i size = texture_->getSize();
-        texW = static_cast<float>(size.x);
-        texH = static_cast<float>(size.y);
-    }
-
-    auto calculateUV = [&](Vector2f pos) -> Vector2f
-    {
-        float ratioX = (localBounds_.w != 0) ? (pos.x - localBounds_.x) / localBounds_.w : 0.0f;
-        float ratioY = (localBounds_.h != 0) ? (pos.y - localBounds_.y) / localBounds_.h : 0.0f;
-
-        float px = textureRect_.x + ratioX * textureRect_.w;
-        float py = textureRect_.y + ratioY * textureRect_.h;
-
-        return {px / texW, py / texH};
-    };
-
-    textureUV_.clear();
-    textureUV_.reserve(localVertices_.size());
-    for (auto &p : localVertices_)
-        textureUV_.push_back(calculateUV(p));
+    mesh.localBounds = {minX, minY, maxX - minX, maxY - minY};
 }
 
 void Shape::updateVertices(const Matrix3x3<float> &matrix) const
 {
     shapeDirty_ = false;
     vertices_.clear();
-    vertices_.reserve(localVertices_.size());
+    vertices_.reserve(mesh_->vertices.size());
 
-    for (const auto &vert : localVertices_)
+    for (const auto &vert : mesh_->vertices)
         vertices_.push_back(matrix.transform(vert));
+
+    textureLevel_ = 0;
+    const float texelArea = std::abs(textureRect_.w * textureRect_.h);
+    if (texture_ && texture_->getLevelCount() > 1 && texelArea > 0.f)
+    {
+        // Прямоугольник текстуры натянут на локальную рамку: переводим площадь рамки в тексели
+        const FloatRect &bounds = mesh_->localBounds;
+        const float localArea = std::abs(bounds.w * bounds.h);
+        textureLevel_ = texture_->selectLevel(std::sqrt(std::abs(matrix.determinant()) * localArea / texelArea));
+    }
 }
 
 void Shape::updateOutlineVertices(const Matrix3x3<float> &matrix) const
 {
     outlineDirty_ = false;
     outlineVertices_.clear();
-    outlineVertices_.reserve(localOutlineVertices_.size());
+    outlineVertices_.reserve(mesh_->outlineVertices.size());
 
-    for (const auto &vert : localOutlineVertices_)
+    for (const auto &vert : mesh_->outlineVertices)
         outlineVertices_.push_back(matrix.transform(vert));
 }
 
@@ -0,0 +1,114 @@
+#include <SDL_wrapper/Graphics/Detail/ShapeMeshRegistry.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+namespace
+{
+
+std::size_t mixHash(std::size_t seed, const float value) noexcept
+{
+    // +0.f приводит -0.f к 0.f, чтобы равные значения давали равный хэш
+    const std::uint32_t bits = std::bit_cast<std::uint32_t>(value + 0.f);
+    return seed ^ (bits + 0x9e3779b9u + (seed << 6) + (seed >> 2));
+}
+
+} // namespace
+
+namespace sdl3::detail
+{
+
+bool ShapeMeshKey::operator==(const ShapeMeshKey &other) const
+{
+    return outlineThickness == other.outlineThickness &&
+           textureRect.x == other.textureRect.x &&
+           textureRect.y == other.textureRect.y &&
+           textureRect.w == other.textureRect.w &&
+           textureRect.h == other.textureRect.h &&
+           textureSize == other.textureSize &&
+           points == other.points &&
+           holes == other.holes;
+}
+
+ShapeMeshRegistry::Storage &ShapeMeshRegistry::storage()
+{
+    static Storage s;
+    return s;
+}
+
+std::size_t ShapeMeshRegistry::hashKey(const ShapeMeshKey &key) noexcept
+{
+    std::size_t seed = key.points.size();
+    for (const auto &p : key.points)
+    {
+        seed = mixHash(seed, p.x);
+        seed = mixHash(seed, p.y);
+    }
+    for (const auto &hole : key.holes)
+    {
+        seed ^= hole.size() + 0x9e3779b9u + (seed << 6) + (seed >> 2);
+        for (const auto &p : hole)
+        {
+            seed = mixHash(seed, p.x);
+            seed = mixHash(seed, p.y);
+        }
+    }
+    seed = mixHash(seed, key.outlineThickness);
+    seed = mixHash(seed, key.textureRect.x);
+    seed = mixHash(seed, key.textureRect.y);
+    seed = mixHash(seed, key.textureRect.w);
+    seed = mixHash(seed, key.textureRect.h);
+    seed = mixHash(seed, static_cast<float>(key.textureSize.x));
+    seed = mixHash(seed, static_cast<float>(key.textureSize.y));
+    return seed;
+}
+
+std::shared_ptr<const ShapeMesh> ShapeMeshRegistry::acquire(ShapeMeshKey key, const Builder build, const ShapeMesh *previous)
+{
+    const std::size_t hash = hashKey(key);
+    Storage &st = storage();
+
+    {
+        std::lock_guard lk(st.mtx);
+        auto [it, end] = st.meshes.equal_range(hash);
+        for (; it != end; ++it)
+        {
+            std::shared_ptr<const ShapeMesh> mesh = it->second.lock();
+            if (mesh && mesh->key == key)
+                return mesh;
+        }
+    }
+
+    // Геометрия строится вне блокировки: это самая дорогая часть
+    auto mesh = std::make_shared<ShapeMesh>();
+    mesh->key = std::move(key);
+    mesh->hash = hash;
+    build(*mesh, previous);
+
+    std::lock_guard lk(st.mtx);
+    auto [it, end] = st.meshes.equal_range(hash);
+    for (; it != end; ++it)
+    {
+        std::shared_ptr<const ShapeMesh> existing = it->second.lock();
+        if (existing && existing->key == mesh->key)
+            return existing;
+    }
+
+    st.meshes.emplace(hash, mesh);
+    if (st.meshes.size() > st.sweepThreshold)
+        sweepExpired(st);
+
+    return mesh;
+}
+
+void ShapeMeshRegistry::sweepExpired(Storage &st)
+{
+    std::erase_if(st.meshes, [](const auto &item)
+    {
+        return item.second.expired();
+    });
+    st.sweepThreshold = std::max(minSweepThreshold, st.meshes.size() * 2);
+}
+
+} // namespace sdl3::detail
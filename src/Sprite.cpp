@@ -1,5 +1,8 @@
 #include <SDL_wrapper/Graphics/DrawTransformObjects/Sprite.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 #include <SDL_wrapper/Graphics/Renders/RenderTarget.hpp>
 #include <SDL_wrapper/Graphics/Texture.hpp>
 
@@ -72,26 +75,63 @@ Vector2f Sprite::getCenterPosition() const
     return pos;
 }
 
+FloatRect Sprite::getLocalBounds() const
+{
+    return {0.f, 0.f, textureRect_.w, textureRect_.h};
+}
+
+FloatRect Sprite::getGlobalBounds() const
+{
+    return getTransformMatrix().transformRect(getLocalBounds());
+}
+
+bool Sprite::containsPoint(const Vector2f &point) const
+{
+    // Без текстуры спрайт не рисуется и не выбирается
+    if (!texture_)
+        return false;
+
+    Matrix3x3<float> inverse;
+    if (!getTransformMatrix().tryInverse(inverse))
+        return false;
+
+    // Отрицательные размеры прямоугольника текстуры отражают спрайт
+    const Vector2f local = inverse.transform(point);
+    return local.x >= std::min(0.f, textureRect_.w) && local.x <= std::max(0.f, textureRect_.w) &&
+           local.y >= std::min(0.f, textureRect_.h) && local.y <= std::max(0.f, textureRect_.h);
+}
+
+unsigned Sprite::getPickVersion() const
+{
+    return getVersion() + localVersion_;
+}
+
 void Sprite::draw(RenderTarget &target) const
 {
     if (!texture_)
         return;
 
     if (viewID_ != target.getViewId() || isGeometryDirty() || dirty_)
+        prepare(target.getRenderContext());
+    target.drawShape(texture_, vertices_, 4, textureUV_, 4, color_, indices_, 6, textureLevel_);
+}
+
+void Sprite::prepare(const RenderContext &context) const
+{
+    if (!texture_)
+        return;
+
+    if (viewID_ != context.viewId || isGeometryDirty() || dirty_)
     {
-        Matrix3x3<float> matrix = target.getView().getTransformMatrix() * getTransformMatrix();
-        const Vector2f screenCenter = target.getTargetCenter();
-        matrix.tx += screenCenter.x;
-        matrix.ty += screenCenter.y;
-        updateVertices(matrix);
-        viewID_ = target.getViewId();
+        updateVertices(context.viewMatrix * getTransformMatrix());
+        viewID_ = context.viewId;
         updateGeometryVersion();
     }
-    target.drawShape(texture_, vertices_, 4, textureUV_, 4, color_, indices_, 6);
 }
 
 void Sprite::updateLocalGeometry()
 {
+    ++localVersion_;
     localVertices_[0] = {0.f, 0.f};
     localVertices_[1] = {textureRect_.w, 0.f};
     localVertices_[2] = {textureRect_.w, textureRect_.h};
@@ -125,6 +165,10 @@ void Sprite::updateVertices(const Matrix3x3<float> &matrix) const
 {
     for (int i = 0; i < 4; ++i)
         vertices_[i] = matrix.transform(localVertices_[i]);
+    // Локальная единица спрайта - тексель, поэтому масштаб текселя на экране берётся прямо из матрицы
+    textureLevel_ = texture_ && texture_->getLevelCount() > 1
+                        ? texture_->selectLevel(std::sqrt(std::abs(matrix.determinant())))
+                        : 0;
     dirty_ = false;
 }
 
@@ -1,53 +1,752 @@
 #include <SDL_wrapper/Graphics/Detail/RendererRegistry.hpp>
 #include <SDL_wrapper/Graphics/Texture.hpp>
+#include <SDL_wrapper/Core/ThreadPool.hpp>
 
 #include <SDL3/SDL_error.h>
+#include <SDL3/SDL_filesystem.h>
 #include <SDL3/SDL_log.h>
 #include <SDL3/SDL_properties.h>
 #include <SDL3/SDL_render.h>
+#include <SDL3/SDL_surface.h>
 #include <SDL3_image/SDL_image.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace
+{
+
+// Уменьшение вдвое фильтром 2x2 для строк [rowBegin, rowEnd) приёмника, обе поверхности RGBA32.
+// Цвет усредняется с весом альфы, чтобы прозрачные пиксели не окрашивали края;
+// при нечётной стороне крайний столбец/строка берётся дважды, и уровень покрывает всё изображение
+void downscaleRows(const SDL_Surface &src, SDL_Surface &dst, const std::size_t rowBegin, const std::size_t rowEnd)
+{
+    constexpr std::size_t bpp = 4;
+    const auto *srcPixels = static_cast<const std::uint8_t *>(src.pixels);
+    auto *dstPixels = static_cast<std::uint8_t *>(dst.pixels);
+
+    for (std::size_t y = rowBegin; y < rowEnd; ++y)
+    {
+        const int sy0 = static_cast<int>(y) * 2;
+        const int sy1 = std::min(sy0 + 1, src.h - 1);
+        const std::uint8_t *row0 = srcPixels + static_cast<std::size_t>(sy0) * static_cast<std::size_t>(src.pitch);
+        const std::uint8_t *row1 = srcPixels + static_cast<std::size_t>(sy1) * static_cast<std::size_t>(src.pitch);
+        std::uint8_t *out = dstPixels + y * static_cast<std::size_t>(dst.pitch);
+
+        for (int x = 0; x < dst.w; ++x, out += bpp)
+        {
+            const std::size_t sx0 = static_cast<std::size_t>(x) * 2 * bpp;
+            const std::size_t sx1 = static_cast<std::size_t>(std::min(x * 2 + 1, src.w - 1)) * bpp;
+            const std::uint8_t *p[4] = {row0 + sx0, row0 + sx1, row1 + sx0, row1 + sx1};
+
+            std::uint32_t alpha = 0;
+            std::uint32_t weighted[3] = {};
+            std::uint32_t plain[3] = {};
+            for (const std::uint8_t *px : p)
+            {
+                alpha += px[3];
+                for (int c = 0; c < 3; ++c)
+                {
+                    weighted[c] += std::uint32_t(px[c]) * px[3];
+                    plain[c] += px[c];
+                }
+            }
+            for (int c = 0; c < 3; ++c)
+                out[c] = static_cast<std::uint8_t>(alpha ? (weighted[c] + alpha / 2) / alpha : (plain[c] + 2) / 4);
+            out[3] = static_cast<std::uint8_t>((alpha + 2) / 4);
+        }
+    }
+}
+
+// Первый обычный (не YUV и не палитровый) формат из списка рендера; порядок списка - предпочтение бэкенда
+SDL_PixelFormat pickNativeFormat(const std::vector<SDL_PixelFormat> &formats, const bool needAlpha, const SDL_PixelFormat fallback)
+{
+    for (const SDL_PixelFormat format : formats)
+    {
+        if (SDL_ISPIXELFORMAT_FOURCC(format) || SDL_ISPIXELFORMAT_INDEXED(format))
+            continue;
+        if (!needAlpha || SDL_ISPIXELFORMAT_ALPHA(format))
+            return format;
+    }
+    return fallback;
+}
+
+std::vector<SDL_PixelFormat> queryRendererFormats(SDL_Renderer *renderer)
+{
+    std::vector<SDL_PixelFormat> formats;
+    const auto *list = static_cast<const SDL_PixelFormat *>(
+        SDL_GetPointerProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_TEXTURE_FORMATS_POINTER, nullptr));
+    for (; list && *list != SDL_PIXELFORMAT_UNKNOWN; ++list)
+        formats.push_back(*list);
+    return formats;
+}
+
+// Наибольший N, который ищется в суффиксе @Nx
+constexpr int maxDensityVariant = 4;
+
+struct DensityVariant
+{
+    std::string path;
+    float scale = 1.f;
+};
+
+// Вариант name@Nx.ext для плотности: наименьший N не меньше плотности (уменьшать лучше, чем растягивать),
+// иначе наибольший из найденных. Файл без суффикса считается вариантом @1x
+DensityVariant resolveDensityVariant(const std::string &fileName, const float density)
+{
+    const std::size_t slash = fileName.find_last_of("/\\");
+    std::size_t dot = fileName.rfind('.');
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+        dot = fileName.size();
+    const std::string stem = fileName.substr(0, dot);
+    const std::string extension = fileName.substr(dot);
+
+    std::vector<DensityVariant> found;
+    if (SDL_GetPathInfo(fileName.c_str(), nullptr))
+        found.push_back({fileName, 1.f});
+    for (int n = found.empty() ? 1 : 2; n <= maxDensityVariant; ++n)
+    {
+        std::string path = stem + '@' + std::to_string(n) + 'x' + extension;
+        if (SDL_GetPathInfo(path.c_str(), nullptr))
+            found.push_back({std::move(path), static_cast<float>(n)});
+    }
+    // Ни одного файла: ошибку сообщит IMG_Load
+    if (found.empty())
+        return {fileName, 1.f};
+
+    // Допуск на неточные масштабы вроде 1.0000001
+    for (DensityVariant &variant : found)
+        if (variant.scale + 0.01f >= density)
+            return std::move(variant);
+    return std::move(found.back());
+}
+
+// Общие потоки фоновых загрузок: их немного и число не зависит от количества загружаемых файлов,
+// остальные задачи ждут в очереди. Задачи, не начатые к выходу из программы, отбрасываются
+class BackgroundLoader
+{
+public:
+    static BackgroundLoader &instance()
+    {
+        static BackgroundLoader loader;
+        return loader;
+    }
+
+    BackgroundLoader(const BackgroundLoader &) = delete;
+    BackgroundLoader &operator=(const BackgroundLoader &) = delete;
+
+    ~BackgroundLoader()
+    {
+        {
+            std::lock_guard lk(mtx_);
+            stop_ = true;
+            tasks_.clear();
+        }
+        wake_.notify_all();
+        for (auto &worker : workers_)
+            worker.join();
+    }
+
+    void submit(std::function<void()> task)
+    {
+        {
+            std::lock_guard lk(mtx_);
+            tasks_.push_back(std::move(task));
+        }
+        wake_.notify_one();
+    }
+
+private:
+    // Декодирование упирается и в диск, и в процессор: половины ядер достаточно, рендеру остаётся запас
+    static constexpr unsigned maxThreads = 4;
+
+    std::mutex mtx_;
+    std::condition_variable wake_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> workers_;
+    bool stop_ = false;
+
+private:
+    BackgroundLoader()
+    {
+        const unsigned threads = std::clamp(std::thread::hardware_concurrency() / 2, 1u, maxThreads);
+        workers_.reserve(threads);
+        for (unsigned i = 0; i < threads; ++i)
+            workers_.emplace_back(&BackgroundLoader::workerLoop, this);
+    }
+
+    void workerLoop()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock lk(mtx_);
+                wake_.wait(lk, [this]
+                {
+                    return stop_ || !tasks_.empty();
+                });
+                if (stop_)
+                    return;
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+};
+
+} // namespace
+
 struct TextureDeleter
 {
+    // Последняя ссылка может уйти в любом потоке, а рендер в это время может воспроизводить кадр
+    std::shared_ptr<std::recursive_mutex> rendererMtx;
+
     void operator()(SDL_Texture *texture) const noexcept
     {
+        if (!rendererMtx)
+        {
+            SDL_DestroyTexture(texture);
+            return;
+        }
+        std::lock_guard lk(*rendererMtx);
         SDL_DestroyTexture(texture);
     }
 };
 
+// Копия общей текстуры в одном из рендеров. Обычно освобождается при отписке рендера, пока он жив;
+// если ссылка пережила рендер, SDL_DestroyRenderer уже освободил текстуру сам
+struct SharedTextureDeleter
+{
+    std::weak_ptr<SDL_Renderer> renderer;
+    std::shared_ptr<std::recursive_mutex> rendererMtx;
+
+    void operator()(SDL_Texture *texture) const noexcept
+    {
+        std::unique_lock<std::recursive_mutex> lk;
+        if (rendererMtx)
+            lk = std::unique_lock(*rendererMtx);
+        if (const std::shared_ptr<SDL_Renderer> alive = renderer.lock())
+            SDL_DestroyTexture(texture);
+    }
+};
+
+struct SurfaceDeleter
+{
+    void operator()(SDL_Surface *surface) const noexcept
+    {
+        SDL_DestroySurface(surface);
+    }
+};
+
 namespace sdl3
 {
 
+// Пиксели, готовые к выгрузке: уровень 0 и цепочка уменьшенных копий в итоговом формате
+struct Texture::DecodedImage
+{
+    std::vector<std::unique_ptr<SDL_Surface, SurfaceDeleter>> levels;
+    bool premultiplied = false;
+    float scale = 1.f; // N варианта name@Nx
+};
+
+// Фоновая загрузка. Задача держит только слабую ссылку: заброшенная до старта не декодируется вовсе,
+// а начатая дорабатывает без ожидания со стороны Texture. Копии Texture делят один результат
+struct Texture::LoadJob
+{
+    std::string path;
+    TextureLoadOptions options;
+    std::vector<SDL_PixelFormat> formats;
+    float scale = 1.f;
+
+    DecodedImage result; // читается только после ready
+    std::atomic<bool> ready = false;
+};
+
+// Копия общей текстуры в одном рендере. Узлы живут до разрушения SharedData, поэтому список читается
+// без блокировок; узел закрытого рендера освобождает текстуры и переиспользуется следующей выгрузкой
+struct Texture::RendererCopy
+{
+    std::atomic<std::size_t> rendererId = detail::RendererRegistry::invalidID;
+    std::vector<std::shared_ptr<SDL_Texture>> levels; // пишется до публикации rendererId
+    RendererCopy *next = nullptr;                      // не меняется после публикации
+};
+
+struct Texture::SharedData
+{
+    DecodedImage decoded;
+    std::mutex mtx; // выгрузка и освобождение копий
+    std::atomic<RendererCopy *> head = nullptr;
+
+    SharedData() = default;
+    SharedData(const SharedData &) = delete;
+    SharedData &operator=(const SharedData &) = delete;
+
+    ~SharedData()
+    {
+        for (RendererCopy *copy = head.load(std::memory_order_relaxed); copy;)
+            delete std::exchange(copy, copy->next);
+    }
+
+    const RendererCopy *find(const std::size_t rendererId) const noexcept
+    {
+        // Свободные узлы помечены invalidID: цель без рендера ничего не находит
+        if (rendererId == detail::RendererRegistry::invalidID)
+            return nullptr;
+        for (const RendererCopy *copy = head.load(std::memory_order_acquire); copy; copy = copy->next)
+            if (copy->rendererId.load(std::memory_order_acquire) == rendererId)
+                return copy;
+        return nullptr;
+    }
+
+    // Живые общие текстуры: закрытие рендера обходит их и освобождает свои копии
+    static std::mutex &liveMutex()
+    {
+        static std::mutex *mtx = new std::mutex();
+        return *mtx;
+    }
+
+    static std::vector<std::weak_ptr<SharedData>> &live()
+    {
+        // Не разрушается: окна со статическим временем жизни могут закрываться после выхода из main
+        static auto *list = new std::vector<std::weak_ptr<SharedData>>();
+        return *list;
+    }
+};
+
 Texture::Texture(const std::size_t windowID) : windowID_(windowID)
 {
 }
 
 bool Texture::loadFromFile(const char *fileName)
+{
+    return loadFromFile(fileName, TextureLoadOptions{});
+}
+
+bool Texture::loadFromFile(const char *fileName, const TextureLoadOptions &options)
 {
     clear();
-    std::shared_ptr<SDL_Renderer> rendererS = detail::RendererRegistry::getRenderer(windowID_).lock();
+    std::shared_ptr<SDL_Renderer> rendererS = detail::RendererRegistry::getRenderer(resolveWindowID()).lock();
     if (!rendererS)
     {
         SDL_Log("There is no renderer to open the texture");
         return false;
     }
-    SDL_Renderer *renderer = rendererS.get();
 
-    SDL_Texture *texture = IMG_LoadTexture(renderer, fileName);
-    if (!texture)
+    const std::vector<SDL_PixelFormat> formats = options.nativeFormat ? queryRendererFormats(rendererS.get())
+                                                                      : std::vector<SDL_PixelFormat>{};
+    DensityVariant variant = options.densityVariants ? resolveDensityVariant(fileName, variantDensity(options))
+                                                     : DensityVariant{fileName, 1.f};
+    DecodedImage decoded = decode(variant.path.c_str(), options, formats);
+    decoded.scale = variant.scale;
+    if (!upload(decoded))
+        return false;
+    rememberSource(fileName, options, std::move(variant.path));
+    return true;
+}
+
+void Texture::loadFromFileAsync(std::string fileName, const TextureLoadOptions &options)
+{
+    clear();
+    std::vector<SDL_PixelFormat> formats;
+    if (options.nativeFormat)
+    {
+        // Список форматов читается сразу: рендер может исчезнуть, пока идёт декодирование
+        if (std::shared_ptr<SDL_Renderer> renderer = detail::RendererRegistry::getRenderer(resolveWindowID()).lock())
+            formats = queryRendererFormats(renderer.get());
+    }
+    DensityVariant variant = options.densityVariants ? resolveDensityVariant(fileName, variantDensity(options))
+                                                     : DensityVariant{fileName, 1.f};
+    rememberSource(std::move(fileName), options, variant.path);
+
+    auto job = std::make_shared<LoadJob>();
+    job->path = std::move(variant.path);
+    job->options = options;
+    // Пул приложения может быть занят подготовкой кадра: фон обходится потоками загрузчика
+    job->options.pool = nullptr;
+    job->formats = std::move(formats);
+    job->scale = variant.scale;
+    pending_ = job;
+
+    BackgroundLoader::instance().submit([weak = std::weak_ptr<LoadJob>(job)]
+    {
+        const std::shared_ptr<LoadJob> job = weak.lock();
+        if (!job)
+            return;
+        try
+        {
+            job->result = decode(job->path.c_str(), job->options, job->formats);
+            job->result.scale = job->scale;
+        }
+        catch (const std::exception &e)
+        {
+            SDL_Log("Texture decoding failed: %s", e.what());
+            job->result = {};
+        }
+        job->ready.store(true, std::memory_order_release);
+    });
+}
+
+bool Texture::isLoading() const
+{
+    return static_cast<bool>(pending_);
+}
+
+bool Texture::isLoadReady() const
+{
+    return pending_ && pending_->ready.load(std::memory_order_acquire);
+}
+
+bool Texture::finishLoading()
+{
+    if (!isLoadReady())
+        return false;
+    // Результат не забирается: копия этой Texture выгрузит его сама
+    const std::shared_ptr<LoadJob> job = std::move(pending_);
+    if (upload(job->result))
+        return true;
+    rememberSource({}, {}, {});
+    return false;
+}
+
+Texture::DecodedImage Texture::decode(const char *fileName, const TextureLoadOptions &options,
+                                      const std::vector<SDL_PixelFormat> &formats)
+{
+    using SurfacePtr = std::unique_ptr<SDL_Surface, SurfaceDeleter>;
+
+    DecodedImage decoded;
+    SurfacePtr source(IMG_Load(fileName));
+    if (!source)
+    {
+        SDL_Log("%s", SDL_GetError());
+        return decoded;
+    }
+
+    // Палитра может нести прозрачность, поэтому для неё альфа тоже нужна
+    const bool hasAlpha = SDL_ISPIXELFORMAT_ALPHA(source->format) || SDL_ISPIXELFORMAT_INDEXED(source->format);
+    SDL_PixelFormat format = source->format;
+    if (options.nativeFormat)
+        format = pickNativeFormat(formats, hasAlpha, format);
+    const bool premultiply = options.premultiplyAlpha && hasAlpha;
+    if (premultiply && !SDL_ISPIXELFORMAT_ALPHA(format))
+        format = SDL_PIXELFORMAT_RGBA32;
+
+    if (options.generateMipmaps)
+    {
+        // Фильтр работает по RGBA32; в итоговый формат уровни переводятся после
+        if (source->format != SDL_PIXELFORMAT_RGBA32)
+            source.reset(SDL_ConvertSurface(source.get(), SDL_PIXELFORMAT_RGBA32));
+        if (!source)
+        {
+            SDL_Log("%s", SDL_GetError());
+            return decoded;
+        }
+        decoded.levels.push_back(std::move(source));
+
+        // Уровни зависят друг от друга, поэтому параллелятся строки внутри уровня
+        while (decoded.levels.back()->w > 1 || decoded.levels.back()->h > 1)
+        {
+            const SDL_Surface &src = *decoded.levels.back();
+            SurfacePtr dst(SDL_CreateSurface((src.w + 1) / 2, (src.h + 1) / 2, SDL_PIXELFORMAT_RGBA32));
+            if (!dst)
+                break;
+
+            SDL_Surface &out = *dst;
+            const auto rows = static_cast<std::size_t>(out.h);
+            if (options.pool)
+                options.pool->parallelFor(rows, [&](const std::size_t begin, const std::size_t end)
+                {
+                    downscaleRows(src, out, begin, end);
+                }, 16);
+            else
+                downscaleRows(src, out, 0, rows);
+
+            decoded.levels.push_back(std::move(dst));
+        }
+    }
+    else
+        decoded.levels.push_back(std::move(source));
+
+    const auto finish = [&](const std::size_t begin, const std::size_t end)
+    {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            SurfacePtr &level = decoded.levels[i];
+            if (level && level->format != format)
+                level.reset(SDL_ConvertSurface(level.get(), format));
+            if (level && premultiply && !SDL_PremultiplySurfaceAlpha(level.get(), false))
+                level.reset();
+        }
+    };
+    if (options.pool && decoded.levels.size() > 1)
+        options.pool->parallelFor(decoded.levels.size(), finish);
+    else
+        finish(0, decoded.levels.size());
+
+    if (std::ranges::any_of(decoded.levels, [](const SurfacePtr &level) { return !level; }))
     {
         SDL_Log("%s", SDL_GetError());
+        decoded.levels.clear();
+        return decoded;
+    }
+    decoded.premultiplied = premultiply;
+    return decoded;
+}
+
+bool Texture::upload(const DecodedImage &decoded)
+{
+    if (decoded.levels.empty())
+        return false;
+
+    const std::size_t windowID = resolveWindowID();
+    std::shared_ptr<SDL_Renderer> rendererS = detail::RendererRegistry::getRenderer(windowID).lock();
+    if (!rendererS)
+    {
+        SDL_Log("There is no renderer to open the texture");
         return false;
     }
-    texture_.reset(texture, TextureDeleter{});
+    std::shared_ptr<std::recursive_mutex> rendererMtx = detail::RendererRegistry::getRendererMutex(windowID);
+
+    // Поверхности уже в формате, который рендер принимает без преобразования
+    std::vector<SDL_Texture *> uploaded;
+    if (!createLevels(rendererS.get(), rendererMtx, decoded, uploaded))
+        return false;
+
+    const auto adopt = [&rendererMtx](SDL_Texture *texture)
+    {
+        return std::shared_ptr<SDL_Texture>(texture, TextureDeleter{rendererMtx});
+    };
+
+    texture_ = adopt(uploaded[0]);
+    premultiplied_ = decoded.premultiplied;
+    scale_ = decoded.scale;
     updateSize();
+    updateLogicalSize();
+
+    mips_.resize(uploaded.size() - 1);
+    for (std::size_t i = 0; i < mips_.size(); ++i)
+    {
+        mips_[i].texture = adopt(uploaded[i + 1]);
+        mips_[i].size = {decoded.levels[i + 1]->w, decoded.levels[i + 1]->h};
+    }
+    return true;
+}
+
+bool Texture::createLevels(SDL_Renderer *renderer, const std::shared_ptr<std::recursive_mutex> &rendererMtx,
+                           const DecodedImage &decoded, std::vector<SDL_Texture *> &textures)
+{
+    textures.clear();
+    textures.reserve(decoded.levels.size());
+
+    std::unique_lock<std::recursive_mutex> lk;
+    if (rendererMtx)
+        lk = std::unique_lock(*rendererMtx);
+    for (const auto &level : decoded.levels)
+    {
+        SDL_Texture *texture = SDL_CreateTextureFromSurface(renderer, level.get());
+        if (!texture)
+            break;
+        if (decoded.premultiplied)
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+        textures.push_back(texture);
+    }
+    if (textures.size() == decoded.levels.size())
+        return true;
+
+    SDL_Log("%s", SDL_GetError());
+    for (SDL_Texture *texture : textures)
+        SDL_DestroyTexture(texture);
+    textures.clear();
+    return false;
+}
+
+bool Texture::loadShared(const char *fileName, const TextureLoadOptions &options)
+{
+    clear();
+    // Рендеры могут предпочитать разные форматы: перевод формата остаётся SDL при выгрузке
+    TextureLoadOptions sharedOptions = options;
+    sharedOptions.nativeFormat = false;
+
+    DensityVariant variant = options.densityVariants ? resolveDensityVariant(fileName, variantDensity(options))
+                                                     : DensityVariant{fileName, 1.f};
+    auto shared = std::make_shared<SharedData>();
+    shared->decoded = decode(variant.path.c_str(), sharedOptions, {});
+    const DecodedImage &decoded = shared->decoded;
+    if (decoded.levels.empty())
+        return false;
+
+    size_ = {decoded.levels[0]->w, decoded.levels[0]->h};
+    format_ = decoded.levels[0]->format;
+    premultiplied_ = decoded.premultiplied;
+    scale_ = variant.scale;
+    updateLogicalSize();
+    mips_.resize(decoded.levels.size() - 1);
+    for (std::size_t i = 0; i < mips_.size(); ++i)
+    {
+        mips_[i].size = {decoded.levels[i + 1]->w, decoded.levels[i + 1]->h};
+    }
+    {
+        std::lock_guard lk(SharedData::liveMutex());
+        auto &live = SharedData::live();
+        std::erase_if(live, [](const std::weak_ptr<SharedData> &data) { return data.expired(); });
+        live.push_back(shared);
+    }
+    shared_ = std::move(shared);
+    rememberSource(fileName, options, std::move(variant.path));
     return true;
 }
 
+bool Texture::isShared() const
+{
+    return static_cast<bool>(shared_);
+}
+
+bool Texture::refreshDensityVariant()
+{
+    if (!sourceOptions_.densityVariants || sourceOptions_.density > 0.f || pending_)
+        return false;
+    if (resolveDensityVariant(sourceName_, variantDensity(sourceOptions_)).path == variantPath_)
+        return false;
+
+    // load* начинают с clear(), поэтому источник копируется
+    const std::string fileName = sourceName_;
+    const TextureLoadOptions options = sourceOptions_;
+    return shared_ ? loadShared(fileName.c_str(), options) : loadFromFile(fileName.c_str(), options);
+}
+
+float Texture::variantDensity(const TextureLoadOptions &options) const
+{
+    return options.density > 0.f ? options.density : detail::RendererRegistry::getDensity(resolveWindowID());
+}
+
+void Texture::rememberSource(std::string fileName, const TextureLoadOptions &options, std::string variantPath)
+{
+    sourceName_ = std::move(fileName);
+    sourceOptions_ = options;
+    variantPath_ = std::move(variantPath);
+}
+
+TextureHandle Texture::getHandle(const std::size_t rendererId, const int level) const
+{
+    if (!shared_)
+        return getHandle(level);
+
+    // Копию пишет и освобождает только поток, рисующий в этот рендер, поэтому её уровни читаются
+    // без блокировки; мьютекс берётся лишь при первой отрисовке в рендере
+    const RendererCopy *copy = shared_->find(rendererId);
+    if (!copy)
+        copy = uploadCopy(rendererId);
+    if (!copy)
+        return {};
+    const auto index = static_cast<std::size_t>(std::clamp(level, 0, static_cast<int>(mips_.size())));
+    return TextureHandle{copy->levels[index].get()};
+}
+
+std::weak_ptr<const SDL_Texture> Texture::getSDLTexture(const std::size_t rendererId, const int level) const
+{
+    if (!shared_)
+        return getSDLTexture(level);
+
+    const RendererCopy *copy = shared_->find(rendererId);
+    if (!copy)
+        return {};
+    const auto index = static_cast<std::size_t>(std::clamp(level, 0, static_cast<int>(mips_.size())));
+    return copy->levels[index];
+}
+
+std::size_t Texture::getLifetimeId() const
+{
+    return lifetime_.getId();
+}
+
+const Texture::RendererCopy *Texture::uploadCopy(const std::size_t rendererId) const
+{
+    std::shared_ptr<SDL_Renderer> renderer = detail::RendererRegistry::getRenderer(rendererId).lock();
+    if (!renderer)
+        return nullptr;
+    std::shared_ptr<std::recursive_mutex> rendererMtx = detail::RendererRegistry::getRendererMutex(rendererId);
+
+    // Порядок блокировок: сначала общие данные, затем рендер (внутри createLevels)
+    std::lock_guard lk(shared_->mtx);
+    if (const RendererCopy *copy = shared_->find(rendererId))
+        return copy;
+
+    std::vector<SDL_Texture *> uploaded;
+    if (!createLevels(renderer.get(), rendererMtx, shared_->decoded, uploaded))
+        return nullptr;
+
+    std::vector<std::shared_ptr<SDL_Texture>> levels;
+    levels.reserve(uploaded.size());
+    for (SDL_Texture *texture : uploaded)
+        levels.emplace_back(texture, SharedTextureDeleter{renderer, rendererMtx});
+
+    RendererCopy *copy = shared_->head.load(std::memory_order_relaxed);
+    while (copy && copy->rendererId.load(std::memory_order_relaxed) != detail::RendererRegistry::invalidID)
+        copy = copy->next;
+    if (copy)
+    {
+        copy->levels = std::move(levels);
+        copy->rendererId.store(rendererId, std::memory_order_release);
+        return copy;
+    }
+
+    auto *created = new RendererCopy();
+    created->levels = std::move(levels);
+    created->rendererId.store(rendererId, std::memory_order_relaxed);
+    created->next = shared_->head.load(std::memory_order_relaxed);
+    shared_->head.store(created, std::memory_order_release);
+    return created;
+}
+
+void Texture::releaseRendererCopies(const std::size_t rendererId) noexcept
+{
+    // Порядок блокировок: список, общие данные, рендер (в удалителе). Вызывается без мьютекса рендера
+    std::lock_guard liveLock(SharedData::liveMutex());
+    for (const auto &weak : SharedData::live())
+    {
+        const std::shared_ptr<SharedData> data = weak.lock();
+        if (!data)
+            continue;
+        std::lock_guard lk(data->mtx);
+        for (RendererCopy *copy = data->head.load(std::memory_order_relaxed); copy; copy = copy->next)
+        {
+            if (copy->rendererId.load(std::memory_order_relaxed) != rendererId)
+                continue;
+            copy->rendererId.store(detail::RendererRegistry::invalidID, std::memory_order_release);
+            copy->levels.clear();
+        }
+    }
+}
+
 void Texture::clear()
 {
+    // Незавершённая фоновая загрузка отбрасывается без ожидания её потока
+    pending_.reset();
     size_ = {};
+    format_ = SDL_PIXELFORMAT_UNKNOWN;
+    premultiplied_ = false;
     texture_.reset();
+    mips_.clear();
+    shared_.reset();
+    logicalSize_ = {};
+    scale_ = 1.f;
+    rememberSource({}, {}, {});
+}
+
+TextureHandle Texture::getHandle() const
+{
+    return TextureHandle{texture_.get()};
 }
 
 std::weak_ptr<const SDL_Texture> Texture::getSDLTexture() const
@@ -61,20 +760,100 @@ std::weak_ptr<SDL_Texture> Texture::getSDLTexture()
 }
 
 const Vector2i &Texture::getSize() const
+{
+    return logicalSize_;
+}
+
+const Vector2i &Texture::getPixelSize() const
 {
     return size_;
 }
 
+float Texture::getScale() const
+{
+    return scale_;
+}
+
+SDL_PixelFormat Texture::getFormat() const
+{
+    return format_;
+}
+
+bool Texture::isPremultiplied() const
+{
+    return premultiplied_;
+}
+
+int Texture::getLevelCount() const
+{
+    return texture_ || shared_ ? static_cast<int>(mips_.size()) + 1 : 0;
+}
+
+int Texture::selectLevel(float texelScale) const
+{
+    // texelScale - экранных пикселей на логический тексель (единицу getSize), в варианте @Nx
+    // на пиксель текстуры их в N раз меньше; ближайший уровень в логарифмической шкале
+    texelScale /= scale_;
+    if (mips_.empty() || !(texelScale < 1.f))
+        return 0;
+    if (texelScale <= 0.f)
+        return static_cast<int>(mips_.size());
+    const int level = static_cast<int>(std::floor(-std::log2(texelScale) + 0.5f));
+    return std::clamp(level, 0, static_cast<int>(mips_.size()));
+}
+
+TextureHandle Texture::getHandle(const int level) const
+{
+    const MipLevel *mip = findMip(level);
+    return mip ? TextureHandle{mip->texture.get()} : getHandle();
+}
+
+std::weak_ptr<const SDL_Texture> Texture::getSDLTexture(const int level) const
+{
+    const MipLevel *mip = findMip(level);
+    if (!mip)
+        return texture_;
+    return mip->texture;
+}
+
+Vector2i Texture::getLevelSize(const int level) const
+{
+    const MipLevel *mip = findMip(level);
+    return mip ? mip->size : size_;
+}
+
+const Texture::MipLevel *Texture::findMip(const int level) const
+{
+    // Уровни за пределами цепочки прижимаются к последнему, 0 и меньше - исходная текстура
+    if (level <= 0 || mips_.empty())
+        return nullptr;
+    return &mips_[static_cast<std::size_t>(std::min(level, static_cast<int>(mips_.size()))) - 1];
+}
+
+std::size_t Texture::resolveWindowID() const
+{
+    return windowID_ == primaryWindow ? detail::RendererRegistry::getPrimaryWindow() : windowID_;
+}
+
+void Texture::updateLogicalSize()
+{
+    logicalSize_ = {static_cast<int>(std::lround(static_cast<float>(size_.x) / scale_)),
+                    static_cast<int>(std::lround(static_cast<float>(size_.y) / scale_))};
+}
+
 void Texture::updateSize()
 {
     if (!texture_)
     {
         size_ = {};
+        format_ = SDL_PIXELFORMAT_UNKNOWN;
         return;
     }
     auto messageTexProps = SDL_GetTextureProperties(texture_.get());
     size_.x = static_cast<int>(SDL_GetNumberProperty(messageTexProps, SDL_PROP_TEXTURE_WIDTH_NUMBER, 0));
     size_.y = static_cast<int>(SDL_GetNumberProperty(messageTexProps, SDL_PROP_TEXTURE_HEIGHT_NUMBER, 0));
+    format_ = static_cast<SDL_PixelFormat>(SDL_GetNumberProperty(messageTexProps, SDL_PROP_TEXTURE_FORMAT_NUMBER,
+                                                                 SDL_PIXELFORMAT_UNKNOWN));
 }
 
 } // namespace sdl3
\ No newline at end of file
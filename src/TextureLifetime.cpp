@@ -0,0 +1,89 @@
+#include <SDL_wrapper/Graphics/Detail/TextureLifetime.hpp>
+#include <SDL_wrapper/Graphics/Texture.hpp>
+
+#include <SDL3/SDL_log.h>
+
+namespace sdl3::detail
+{
+
+TextureLifetime::Storage &TextureLifetime::storage()
+{
+    // Не разрушается: текстуры со статическим временем жизни могут разрушаться после выхода из main
+    static Storage *s = new Storage();
+    return *s;
+}
+
+std::size_t TextureLifetime::acquire() noexcept
+{
+    try
+    {
+        return storage().insert(true);
+    }
+    catch (...)
+    {
+        // Без памяти под слот текстура просто не проверяется
+        return invalidID;
+    }
+}
+
+TextureLifetime::TextureLifetime() noexcept
+    : id_(acquire())
+{
+}
+
+TextureLifetime::TextureLifetime(const TextureLifetime &) noexcept
+    : id_(acquire())
+{
+}
+
+TextureLifetime::TextureLifetime(TextureLifetime &&) noexcept
+    : id_(acquire())
+{
+}
+
+TextureLifetime &TextureLifetime::operator=(const TextureLifetime &) noexcept
+{
+    return *this;
+}
+
+TextureLifetime &TextureLifetime::operator=(TextureLifetime &&) noexcept
+{
+    return *this;
+}
+
+TextureLifetime::~TextureLifetime()
+{
+    if (id_ != invalidID)
+        storage().erase(id_);
+}
+
+std::size_t TextureLifetime::getId() const noexcept
+{
+    return id_;
+}
+
+bool TextureLifetime::isAlive(std::size_t id) noexcept
+{
+    return storage().contains(id);
+}
+
+TextureRef::TextureRef(const Texture *texture)
+    : texture_(texture),
+      id_(texture ? texture->getLifetimeId() : TextureLifetime::invalidID)
+{
+}
+
+bool TextureRef::checkAlive() const noexcept
+{
+    if (id_ == TextureLifetime::invalidID || TextureLifetime::isAlive(id_))
+        return true;
+
+    if (!reported_)
+    {
+        SDL_Log("Texture was destroyed while a drawable still refers to it; the drawable is skipped");
+        reported_ = true;
+    }
+    return false;
+}
+
+} // namespace sdl3::detail
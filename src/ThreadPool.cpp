@@ -0,0 +1,134 @@
+#include <SDL_wrapper/Core/ThreadPool.hpp>
+
+#include <algorithm>
+
+namespace sdl3
+{
+
+ThreadPool::ThreadPool(std::size_t threadCount)
+{
+    if (threadCount == 0)
+    {
+        const unsigned hardware = std::thread::hardware_concurrency();
+        threadCount = hardware > 1 ? hardware - 1 : 0;
+    }
+
+    workers_.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+        workers_.emplace_back(&ThreadPool::workerLoop, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lk(mtx_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto &worker : workers_)
+        worker.join();
+}
+
+std::size_t ThreadPool::getThreadCount() const
+{
+    return workers_.size();
+}
+
+void ThreadPool::parallelFor(const std::size_t count, const RangeTask &task, std::size_t grain)
+{
+    if (count == 0)
+        return;
+    grain = std::max<std::size_t>(grain, 1);
+
+    if (workers_.empty() || count <= grain)
+    {
+        task(0, count);
+        return;
+    }
+
+    // Кусков в несколько раз больше потоков - для выравнивания неравномерной нагрузки
+    const std::size_t threads = workers_.size() + 1;
+    const std::size_t chunk = std::max(grain, (count + threads * 4 - 1) / (threads * 4));
+
+    std::lock_guard call(callMtx_);
+
+    Job job;
+    job.task = &task;
+    job.count = count;
+    job.grain = chunk;
+
+    {
+        std::lock_guard lk(mtx_);
+        job_ = &job;
+        active_ = workers_.size();
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    runChunks(job);
+
+    {
+        std::unique_lock lk(mtx_);
+        finished_.wait(lk, [this]
+        {
+            return active_ == 0;
+        });
+        job_ = nullptr;
+    }
+
+    if (job.error)
+        std::rethrow_exception(job.error);
+}
+
+void ThreadPool::workerLoop()
+{
+    std::uint64_t seen = 0;
+    while (true)
+    {
+        Job *job = nullptr;
+        {
+            std::unique_lock lk(mtx_);
+            wake_.wait(lk, [&]
+            {
+                return stop_ || generation_ != seen;
+            });
+            if (stop_)
+                return;
+            seen = generation_;
+            job = job_;
+        }
+
+        runChunks(*job);
+
+        std::lock_guard lk(mtx_);
+        if (--active_ == 0)
+            finished_.notify_one();
+    }
+}
+
+void ThreadPool::runChunks(Job &job)
+{
+    while (true)
+    {
+        const std::size_t begin = job.next.fetch_add(job.grain, std::memory_order_relaxed);
+        if (begin >= job.count)
+            return;
+        const std::size_t end = std::min(begin + job.grain, job.count);
+
+        try
+        {
+            (*job.task)(begin, end);
+        }
+        catch (...)
+        {
+            std::lock_guard lk(job.errorMtx);
+            if (!job.error)
+                job.error = std::current_exception();
+            // Остальные куски пропускаются
+            job.next.store(job.count, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+} // namespace sdl3
@@ -0,0 +1,1164 @@
+// Ear clipping below is a port of earcut (https://github.com/mapbox/earcut), distributed under the ISC License:
+//
+// ISC License
+//
+// Copyright (c) 2016, Mapbox
+//
+// Permission to use, copy, modify, and/or distribute this software for any purpose
+// with or without fee is hereby granted, provided that the above copyright notice
+// and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND ISC DISCLAIMS ALL WARRANTIES WITH REGARD TO
+// THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS.
+// IN NO EVENT SHALL ISC BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA
+// OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,
+// ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <SDL_wrapper/Core/Math/Triangulation.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <set>
+#include <utility>
+
+namespace
+{
+
+struct Node
+{
+    int i = 0;
+    double x = 0.0;
+    double y = 0.0;
+
+    Node *prev = nullptr;
+    Node *next = nullptr;
+
+    // z-order кривая для ускорения поиска точек внутри уха
+    std::int32_t z = 0;
+    Node *prevZ = nullptr;
+    Node *nextZ = nullptr;
+
+    bool steiner = false;
+};
+
+// Минимальное число вершин, с которого включается z-order хэширование
+constexpr std::size_t hashingThreshold = 80;
+
+class EarClipper
+{
+public:
+    explicit EarClipper(std::vector<int> &triangles) : triangles_(triangles)
+    {
+    }
+
+    void run(std::span<const sdl3::Vector2f> outer, std::span<const std::vector<sdl3::Vector2f>> holes)
+    {
+        Node *outerNode = linkedList(outer, 0, true);
+        if (!outerNode || outerNode->next == outerNode->prev)
+            return;
+
+        std::size_t total = outer.size();
+        int offset = static_cast<int>(outer.size());
+        std::vector<Node *> queue;
+        queue.reserve(holes.size());
+        for (const auto &hole : holes)
+        {
+            Node *list = linkedList(hole, offset, false);
+            offset += static_cast<int>(hole.size());
+            total += hole.size();
+            if (!list)
+                continue;
+            if (list == list->next)
+                list->steiner = true;
+            queue.push_back(getLeftmost(list));
+        }
+
+        std::sort(queue.begin(), queue.end(), [](const Node *a, const Node *b)
+        {
+            return a->x < b->x;
+        });
+        for (Node *hole : queue)
+            outerNode = eliminateHole(hole, outerNode);
+
+        if (total > hashingThreshold)
+        {
+            double minX = outer[0].x, maxX = outer[0].x;
+            double minY = outer[0].y, maxY = outer[0].y;
+            for (const auto &p : outer)
+            {
+                minX = std::min<double>(minX, p.x);
+                minY = std::min<double>(minY, p.y);
+                maxX = std::max<double>(maxX, p.x);
+                maxY = std::max<double>(maxY, p.y);
+            }
+            minX_ = minX;
+            minY_ = minY;
+            const double size = std::max(maxX - minX, maxY - minY);
+            invSize_ = size != 0.0 ? 32767.0 / size : 0.0;
+        }
+
+        earcutLinked(outerNode, 0);
+    }
+
+private:
+    std::vector<int> &triangles_;
+    std::deque<Node> nodes_;
+
+    double minX_ = 0.0;
+    double minY_ = 0.0;
+    double invSize_ = 0.0;
+
+private:
+    Node *linkedList(std::span<const sdl3::Vector2f> points, const int offset, const bool clockwise)
+    {
+        if (points.empty())
+            return nullptr;
+
+        double sum = 0.0;
+        for (std::size_t i = 0, j = points.size() - 1; i < points.size(); j = i++)
+            sum += (static_cast<double>(points[j].x) - points[i].x) * (static_cast<double>(points[i].y) + points[j].y);
+
+        Node *last = nullptr;
+        if (clockwise == (sum > 0.0))
+        {
+            for (std::size_t i = 0; i < points.size(); ++i)
+                last = insertNode(offset + static_cast<int>(i), points[i], last);
+        }
+        else
+        {
+            for (std::size_t i = points.size(); i-- > 0;)
+                last = insertNode(offset + static_cast<int>(i), points[i], last);
+        }
+
+        if (last && equals(last, last->next))
+        {
+            removeNode(last);
+            last = last->next;
+        }
+        return last;
+    }
+
+    Node *filterPoints(Node *start, Node *end = nullptr)
+    {
+        if (!start)
+            return start;
+        if (!end)
+            end = start;
+
+        Node *p = start;
+        bool again = false;
+        do
+        {
+            again = false;
+            if (!p->steiner && (equals(p, p->next) || area(p->prev, p, p->next) == 0.0))
+            {
+                removeNode(p);
+                p = end = p->prev;
+                if (p == p->next)
+                    break;
+                again = true;
+            }
+            else
+                p = p->next;
+        } while (again || p != end);
+
+        return end;
+    }
+
+    void earcutLinked(Node *ear, const int pass)
+    {
+        if (!ear)
+            return;
+
+        if (pass == 0 && invSize_ != 0.0)
+            indexCurve(ear);
+
+        Node *stop = ear;
+        while (ear->prev != ear->next)
+        {
+            Node *prev = ear->prev;
+            Node *next = ear->next;
+
+            if (invSize_ != 0.0 ? isEarHashed(ear) : isEar(ear))
+            {
+                addTriangle(prev, ear, next);
+                removeNode(ear);
+
+                // Пропуск следующей вершины даёт меньше вытянутых треугольников
+                ear = next->next;
+                stop = next->next;
+                continue;
+            }
+
+            ear = next;
+            if (ear == stop)
+            {
+                if (pass == 0)
+                    earcutLinked(filterPoints(ear), 1);
+                else if (pass == 1)
+                    earcutLinked(cureLocalIntersections(filterPoints(ear)), 2);
+                else if (pass == 2)
+                    splitEarcut(ear);
+                break;
+            }
+        }
+    }
+
+    bool isEar(const Node *ear) const
+    {
+        const Node *a = ear->prev;
+        const Node *b = ear;
+        const Node *c = ear->next;
+        if (area(a, b, c) >= 0.0)
+            return false;
+
+        const double x0 = std::min({a->x, b->x, c->x});
+        const double y0 = std::min({a->y, b->y, c->y});
+        const double x1 = std::max({a->x, b->x, c->x});
+        const double y1 = std::max({a->y, b->y, c->y});
+
+        for (const Node *p = c->next; p != a; p = p->next)
+        {
+            if (p->x >= x0 && p->x <= x1 && p->y >= y0 && p->y <= y1 &&
+                pointInTriangle(a->x, a->y, b->x, b->y, c->x, c->y, p->x, p->y) &&
+                area(p->prev, p, p->next) >= 0.0)
+                return false;
+        }
+        return true;
+    }
+
+    bool isEarHashed(const Node *ear) const
+    {
+        const Node *a = ear->prev;
+        const Node *b = ear;
+        const Node *c = ear->next;
+        if (area(a, b, c) >= 0.0)
+            return false;
+
+        const double x0 = std::min({a->x, b->x, c->x});
+        const double y0 = std::min({a->y, b->y, c->y});
+        const double x1 = std::max({a->x, b->x, c->x});
+        const double y1 = std::max({a->y, b->y, c->y});
+
+        const std::int32_t minZ = zOrder(x0, y0);
+        const std::int32_t maxZ = zOrder(x1, y1);
+
+        auto blocks = [&](const Node *p)
+        {
+            return p->x >= x0 && p->x <= x1 && p->y >= y0 && p->y <= y1 && p != a && p != c &&
+                   pointInTriangle(a->x, a->y, b->x, b->y, c->x, c->y, p->x, p->y) &&
+                   area(p->prev, p, p->next) >= 0.0;
+        };
+
+        const Node *p = ear->prevZ;
+        const Node *n = ear->nextZ;
+        while (p && p->z >= minZ && n && n->z <= maxZ)
+        {
+            if (blocks(p))
+                return false;
+            p = p->prevZ;
+            if (blocks(n))
+                return false;
+            n = n->nextZ;
+        }
+        for (; p && p->z >= minZ; p = p->prevZ)
+        {
+            if (blocks(p))
+                return false;
+        }
+        for (; n && n->z <= maxZ; n = n->nextZ)
+        {
+            if (blocks(n))
+                return false;
+        }
+        return true;
+    }
+
+    Node *cureLocalIntersections(Node *start)
+    {
+        Node *p = start;
+        do
+        {
+            Node *a = p->prev;
+            Node *b = p->next->next;
+
+            if (!equals(a, b) && intersects(a, p, p->next, b) && locallyInside(a, b) && locallyInside(b, a))
+            {
+                addTriangle(a, p, b);
+                removeNode(p);
+                removeNode(p->next);
+                p = start = b;
+            }
+            p = p->next;
+        } while (p != start);
+
+        return filterPoints(p);
+    }
+
+    void splitEarcut(Node *start)
+    {
+        Node *a = start;
+        do
+        {
+            for (Node *b = a->next->next; b != a->prev; b = b->next)
+            {
+                if (a->i != b->i && isValidDiagonal(a, b))
+                {
+                    Node *c = splitPolygon(a, b);
+                    a = filterPoints(a, a->next);
+                    c = filterPoints(c, c->next);
+                    earcutLinked(a, 0);
+                    earcutLinked(c, 0);
+                    return;
+                }
+            }
+            a = a->next;
+        } while (a != start);
+    }
+
+    Node *eliminateHole(Node *hole, Node *outerNode)
+    {
+        Node *bridge = findHoleBridge(hole, outerNode);
+        if (!bridge)
+            return outerNode;
+
+        Node *bridgeReverse = splitPolygon(bridge, hole);
+        filterPoints(bridgeReverse, bridgeReverse->next);
+        return filterPoints(bridge, bridge->next);
+    }
+
+    // Алгоритм Эберли: мост от самой левой точки отверстия к внешнему контуру
+    Node *findHoleBridge(Node *hole, Node *outerNode) const
+    {
+        Node *p = outerNode;
+        const double hx = hole->x;
+        const double hy = hole->y;
+        double qx = -std::numeric_limits<double>::infinity();
+        Node *m = nullptr;
+
+        do
+        {
+            if (hy <= p->y && hy >= p->next->y && p->next->y != p->y)
+            {
+                const double x = p->x + (hy - p->y) * (p->next->x - p->x) / (p->next->y - p->y);
+                if (x <= hx && x > qx)
+                {
+                    qx = x;
+                    m = p->x < p->next->x ? p : p->next;
+                    if (x == hx)
+                        return m;
+                }
+            }
+            p = p->next;
+        } while (p != outerNode);
+
+        if (!m)
+            return nullptr;
+
+        const Node *stop = m;
+        const double mx = m->x;
+        const double my = m->y;
+        double tanMin = std::numeric_limits<double>::infinity();
+
+        p = m;
+        do
+        {
+            if (hx >= p->x && p->x >= mx && hx != p->x &&
+                pointInTriangle(hy < my ? hx : qx, hy, mx, my, hy < my ? qx : hx, hy, p->x, p->y))
+            {
+                const double tan = std::abs(hy - p->y) / (hx - p->x);
+                if (locallyInside(p, hole) &&
+                    (tan < tanMin || (tan == tanMin && (p->x > m->x || (p->x == m->x && sectorContainsSector(m, p))))))
+                {
+                    m = p;
+                    tanMin = tan;
+                }
+            }
+            p = p->next;
+        } while (p != stop);
+
+        return m;
+    }
+
+    static bool sectorContainsSector(const Node *m, const Node *p)
+    {
+        return area(m->prev, m, p->prev) < 0.0 && area(p->next, m, m->next) < 0.0;
+    }
+
+    void indexCurve(Node *start) const
+    {
+        Node *p = start;
+        do
+        {
+            if (p->z == 0)
+                p->z = zOrder(p->x, p->y);
+            p->prevZ = p->prev;
+            p->nextZ = p->next;
+            p = p->next;
+        } while (p != start);
+
+        p->prevZ->nextZ = nullptr;
+        p->prevZ = nullptr;
+
+        sortLinked(p);
+    }
+
+    // Сортировка слиянием связного списка (Simon Tatham)
+    static Node *sortLinked(Node *list)
+    {
+        int inSize = 1;
+        int numMerges = 0;
+        do
+        {
+            Node *p = list;
+            Node *tail = nullptr;
+            list = nullptr;
+            numMerges = 0;
+
+            while (p)
+            {
+                ++numMerges;
+                Node *q = p;
+                int pSize = 0;
+                for (int i = 0; i < inSize; ++i)
+                {
+                    ++pSize;
+                    q = q->nextZ;
+                    if (!q)
+                        break;
+                }
+
+                int qSize = inSize;
+                while (pSize > 0 || (qSize > 0 && q))
+                {
+                    Node *e = nullptr;
+                    if (pSize != 0 && (qSize == 0 || !q || p->z <= q->z))
+                    {
+                        e = p;
+                        p = p->nextZ;
+                        --pSize;
+                    }
+                    else
+                    {
+                        e = q;
+                        q = q->nextZ;
+                        --qSize;
+                    }
+
+                    if (tail)
+                        tail->nextZ = e;
+                    else
+                        list = e;
+
+                    e->prevZ = tail;
+                    tail = e;
+                }
+                p = q;
+            }
+
+            tail->nextZ = nullptr;
+            inSize *= 2;
+        } while (numMerges > 1);
+
+        return list;
+    }
+
+    std::int32_t zOrder(const double px, const double py) const
+    {
+        std::int32_t x = static_cast<std::int32_t>((px - minX_) * invSize_);
+        std::int32_t y = static_cast<std::int32_t>((py - minY_) * invSize_);
+
+        x = (x | (x << 8)) & 0x00FF00FF;
+        x = (x | (x << 4)) & 0x0F0F0F0F;
+        x = (x | (x << 2)) & 0x33333333;
+        x = (x | (x << 1)) & 0x55555555;
+
+        y = (y | (y << 8)) & 0x00FF00FF;
+        y = (y | (y << 4)) & 0x0F0F0F0F;
+        y = (y | (y << 2)) & 0x33333333;
+        y = (y | (y << 1)) & 0x55555555;
+
+        return x | (y << 1);
+    }
+
+    static Node *getLeftmost(Node *start)
+    {
+        Node *p = start;
+        Node *leftmost = start;
+        do
+        {
+            if (p->x < leftmost->x || (p->x == leftmost->x && p->y < leftmost->y))
+                leftmost = p;
+            p = p->next;
+        } while (p != start);
+        return leftmost;
+    }
+
+    static bool pointInTriangle(const double ax, const double ay, const double bx, const double by,
+                                const double cx, const double cy, const double px, const double py)
+    {
+        return (cx - px) * (ay - py) >= (ax - px) * (cy - py) &&
+               (ax - px) * (by - py) >= (bx - px) * (ay - py) &&
+               (bx - px) * (cy - py) >= (cx - px) * (by - py);
+    }
+
+    static bool isValidDiagonal(const Node *a, const Node *b)
+    {
+        return a->next->i != b->i && a->prev->i != b->i && !intersectsPolygon(a, b) &&
+               ((locallyInside(a, b) && locallyInside(b, a) && middleInside(a, b) &&
+                 (area(a->prev, a, b->prev) != 0.0 || area(a, b->prev, b) != 0.0)) ||
+                (equals(a, b) && area(a->prev, a, a->next) > 0.0 && area(b->prev, b, b->next) > 0.0));
+    }
+
+    static double area(const Node *p, const Node *q, const Node *r)
+    {
+        return (q->y - p->y) * (r->x - q->x) - (q->x - p->x) * (r->y - q->y);
+    }
+
+    static bool equals(const Node *p1, const Node *p2)
+    {
+        return p1->x == p2->x && p1->y == p2->y;
+    }
+
+    static int sign(const double value)
+    {
+        return (value > 0.0) - (value < 0.0);
+    }
+
+    static bool onSegment(const Node *p, const Node *q, const Node *r)
+    {
+        return q->x <= std::max(p->x, r->x) && q->x >= std::min(p->x, r->x) &&
+               q->y <= std::max(p->y, r->y) && q->y >= std::min(p->y, r->y);
+    }
+
+    static bool intersects(const Node *p1, const Node *q1, const Node *p2, const Node *q2)
+    {
+        const int o1 = sign(area(p1, q1, p2));
+        const int o2 = sign(area(p1, q1, q2));
+        const int o3 = sign(area(p2, q2, p1));
+        const int o4 = sign(area(p2, q2, q1));
+
+        if (o1 != o2 && o3 != o4)
+            return true;
+
+        if (o1 == 0 && onSegment(p1, p2, q1))
+            return true;
+        if (o2 == 0 && onSegment(p1, q2, q1))
+            return true;
+        if (o3 == 0 && onSegment(p2, p1, q2))
+            return true;
+        if (o4 == 0 && onSegment(p2, q1, q2))
+            return true;
+
+        return false;
+    }
+
+    static bool intersectsPolygon(const Node *a, const Node *b)
+    {
+        const Node *p = a;
+        do
+        {
+            if (p->i != a->i && p->next->i != a->i && p->i != b->i && p->next->i != b->i &&
+                intersects(p, p->next, a, b))
+                return true;
+            p = p->next;
+        } while (p != a);
+        return false;
+    }
+
+    static bool locallyInside(const Node *a, const Node *b)
+    {
+        return area(a->prev, a, a->next) < 0.0
+                   ? area(a, b, a->next) >= 0.0 && area(a, a->prev, b) >= 0.0
+                   : area(a, b, a->prev) < 0.0 || area(a, a->next, b) < 0.0;
+    }
+
+    static bool middleInside(const Node *a, const Node *b)
+    {
+        const Node *p = a;
+        bool inside = false;
+        const double px = (a->x + b->x) / 2.0;
+        const double py = (a->y + b->y) / 2.0;
+        do
+        {
+            if (((p->y > py) != (p->next->y > py)) && p->next->y != p->y &&
+                (px < (p->next->x - p->x) * (py - p->y) / (p->next->y - p->y) + p->x))
+                inside = !inside;
+            p = p->next;
+        } while (p != a);
+        return inside;
+    }
+
+    // Соединяет две вершины мостом: одно кольцо делится на два, а кольцо с отверстием сливается в одно
+    Node *splitPolygon(Node *a, Node *b)
+    {
+        Node *a2 = &nodes_.emplace_back(Node{a->i, a->x, a->y});
+        Node *b2 = &nodes_.emplace_back(Node{b->i, b->x, b->y});
+        Node *an = a->next;
+        Node *bp = b->prev;
+
+        a->next = b;
+        b->prev = a;
+
+        a2->next = an;
+        an->prev = a2;
+
+        b2->next = a2;
+        a2->prev = b2;
+
+        bp->next = b2;
+        b2->prev = bp;
+
+        return b2;
+    }
+
+    Node *insertNode(const int i, const sdl3::Vector2f &point, Node *last)
+    {
+        Node *p = &nodes_.emplace_back(Node{i, point.x, point.y});
+        if (!last)
+        {
+            p->prev = p;
+            p->next = p;
+        }
+        else
+        {
+            p->next = last->next;
+            p->prev = last;
+            last->next->prev = p;
+            last->next = p;
+        }
+        return p;
+    }
+
+    static void removeNode(Node *p)
+    {
+        p->next->prev = p->prev;
+        p->prev->next = p->next;
+
+        if (p->prevZ)
+            p->prevZ->nextZ = p->nextZ;
+        if (p->nextZ)
+            p->nextZ->prevZ = p->prevZ;
+    }
+
+    void addTriangle(const Node *a, const Node *b, const Node *c)
+    {
+        triangles_.push_back(a->i);
+        triangles_.push_back(b->i);
+        triangles_.push_back(c->i);
+    }
+};
+
+
+// Разбиение на y-монотонные части заметающей прямой и их линейная триангуляция, O(n log n).
+// Используется для больших входов, где отсечение ушей может деградировать до O(n^2).
+class MonotoneTriangulator
+{
+public:
+    explicit MonotoneTriangulator(std::vector<int> &triangles) : triangles_(triangles)
+    {
+    }
+
+    bool run(std::span<const sdl3::Vector2f> outer, std::span<const std::vector<sdl3::Vector2f>> holes)
+    {
+        if (!addRing(outer, true))
+            return false;
+        std::size_t ringCount = 1;
+        int offset = static_cast<int>(outer.size());
+        for (const auto &hole : holes)
+        {
+            if (!addRing(hole, false, offset))
+                return false;
+            offset += static_cast<int>(hole.size());
+            ++ringCount;
+        }
+
+        if (!partition())
+            return false;
+        buildFaces();
+
+        const std::size_t expected = (verts_.size() + 2 * ringCount - 4) * 3;
+        return triangles_.size() == expected;
+    }
+
+private:
+    enum class VertexType : unsigned char
+    {
+        Start,
+        End,
+        Split,
+        Merge,
+        Regular
+    };
+
+    // Координата y отражена: алгоритм записан для оси y, направленной вверх
+    struct Vertex
+    {
+        double x = 0.0;
+        double y = 0.0;
+        int index = 0;
+        int prev = 0;
+        int next = 0;
+    };
+
+    struct EdgeLess
+    {
+        using is_transparent = void;
+
+        const MonotoneTriangulator *self;
+
+        bool operator()(const int e1, const int e2) const
+        {
+            return self->edgeLess(e1, e2);
+        }
+        bool operator()(const int e, const Vertex &p) const
+        {
+            return self->side(e, p) > 0.0;
+        }
+        bool operator()(const Vertex &p, const int e) const
+        {
+            return self->side(e, p) < 0.0;
+        }
+    };
+
+    std::vector<int> &triangles_;
+    std::vector<Vertex> verts_;
+    std::vector<std::pair<int, int>> diagonals_;
+
+private:
+    bool addRing(std::span<const sdl3::Vector2f> points, const bool outer, const int offset = 0)
+    {
+        const int first = static_cast<int>(verts_.size());
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            const double x = points[i].x;
+            const double y = -static_cast<double>(points[i].y);
+            if (static_cast<int>(verts_.size()) > first && verts_.back().x == x && verts_.back().y == y)
+                continue;
+            verts_.push_back(Vertex{x, y, offset + static_cast<int>(i)});
+        }
+        while (static_cast<int>(verts_.size()) > first + 1 &&
+               verts_.back().x == verts_[first].x && verts_.back().y == verts_[first].y)
+            verts_.pop_back();
+
+        const int last = static_cast<int>(verts_.size()) - 1;
+        if (last - first < 2)
+            return false;
+
+        double area = 0.0;
+        for (int i = first, j = last; i <= last; j = i++)
+            area += verts_[j].x * verts_[i].y - verts_[i].x * verts_[j].y;
+        if (area == 0.0)
+            return false;
+
+        // Внешний контур против часовой стрелки, отверстия - по часовой: внутренность всегда слева
+        const bool forward = outer == (area > 0.0);
+        for (int i = first; i <= last; ++i)
+        {
+            const int before = i == first ? last : i - 1;
+            const int after = i == last ? first : i + 1;
+            verts_[i].prev = forward ? before : after;
+            verts_[i].next = forward ? after : before;
+        }
+        return true;
+    }
+
+    bool above(const int a, const int b) const
+    {
+        const Vertex &va = verts_[a];
+        const Vertex &vb = verts_[b];
+        return va.y > vb.y || (va.y == vb.y && va.x < vb.x);
+    }
+
+    static double cross(const Vertex &o, const Vertex &a, const Vertex &b)
+    {
+        return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+    }
+
+    // > 0 - точка восточнее ребра, < 0 - западнее
+    double side(const int e, const Vertex &p) const
+    {
+        return cross(verts_[e], verts_[verts_[e].next], p);
+    }
+
+    bool edgeLess(const int e1, const int e2) const
+    {
+        if (e1 == e2)
+            return false;
+        const Vertex &a1 = verts_[e1];
+        const Vertex &a2 = verts_[e2];
+        if (!above(e1, e2))
+        {
+            const double s = side(e2, a1);
+            return s != 0.0 ? s < 0.0 : side(e2, verts_[a1.next]) < 0.0;
+        }
+        const double s = side(e1, a2);
+        return s != 0.0 ? s > 0.0 : side(e1, verts_[a2.next]) > 0.0;
+    }
+
+    VertexType classify(const int v) const
+    {
+        const Vertex &cur = verts_[v];
+        const bool prevBelow = above(v, cur.prev);
+        const bool nextBelow = above(v, cur.next);
+        const double turn = cross(verts_[cur.prev], cur, verts_[cur.next]);
+
+        if (prevBelow && nextBelow)
+            return turn > 0.0 ? VertexType::Start : VertexType::Split;
+        if (!prevBelow && !nextBelow)
+            return turn > 0.0 ? VertexType::End : VertexType::Merge;
+        return VertexType::Regular;
+    }
+
+    bool partition()
+    {
+        const int count = static_cast<int>(verts_.size());
+        std::vector<int> events(static_cast<std::size_t>(count));
+        for (int i = 0; i < count; ++i)
+            events[i] = i;
+        std::sort(events.begin(), events.end(), [this](const int a, const int b)
+        {
+            return above(a, b);
+        });
+
+        std::vector<VertexType> types(static_cast<std::size_t>(count));
+        for (int i = 0; i < count; ++i)
+            types[i] = classify(i);
+
+        std::vector<int> helper(static_cast<std::size_t>(count), -1);
+        std::set<int, EdgeLess> status(EdgeLess{this});
+
+        auto connectMergeHelper = [&](const int v, const int e)
+        {
+            const int h = helper[e];
+            if (h >= 0 && types[h] == VertexType::Merge)
+                diagonals_.emplace_back(v, h);
+        };
+
+        auto leftEdge = [&](const int v) -> int
+        {
+            auto it = status.lower_bound(verts_[v]);
+            if (it == status.begin())
+                return -1;
+            return *std::prev(it);
+        };
+
+        for (const int v : events)
+        {
+            const int prevEdge = verts_[v].prev;
+            switch (types[v])
+            {
+            case VertexType::Start:
+                status.insert(v);
+                helper[v] = v;
+                break;
+
+            case VertexType::End:
+                connectMergeHelper(v, prevEdge);
+                status.erase(prevEdge);
+                break;
+
+            case VertexType::Split:
+            {
+                const int e = leftEdge(v);
+                if (e < 0)
+                    return false;
+                diagonals_.emplace_back(v, helper[e]);
+                helper[e] = v;
+                status.insert(v);
+                helper[v] = v;
+                break;
+            }
+
+            case VertexType::Merge:
+            {
+                connectMergeHelper(v, prevEdge);
+                status.erase(prevEdge);
+                const int e = leftEdge(v);
+                if (e < 0)
+                    return false;
+                connectMergeHelper(v, e);
+                helper[e] = v;
+                break;
+            }
+
+            case VertexType::Regular:
+                if (above(verts_[v].prev, v))
+                {
+                    // Внутренность справа от вершины: левая цепь
+                    connectMergeHelper(v, prevEdge);
+                    status.erase(prevEdge);
+                    status.insert(v);
+                    helper[v] = v;
+                }
+                else
+                {
+                    const int e = leftEdge(v);
+                    if (e < 0)
+                        return false;
+                    connectMergeHelper(v, e);
+                    helper[e] = v;
+                }
+                break;
+            }
+        }
+        return true;
+    }
+
+    void buildFaces()
+    {
+        const int count = static_cast<int>(verts_.size());
+
+        // Смежность в CSR-виде: рёбра контура в обе стороны плюс диагонали
+        std::vector<int> offsets(static_cast<std::size_t>(count) + 1, 2);
+        offsets[count] = 0;
+        for (const auto &[a, b] : diagonals_)
+        {
+            ++offsets[a];
+            ++offsets[b];
+        }
+        int total = 0;
+        for (int i = 0; i <= count; ++i)
+        {
+            const int degree = offsets[i];
+            offsets[i] = total;
+            total += degree;
+        }
+
+        std::vector<int> adjacency(static_cast<std::size_t>(total));
+        std::vector<int> fill(offsets.begin(), offsets.end() - 1);
+        for (int v = 0; v < count; ++v)
+        {
+            adjacency[fill[v]++] = verts_[v].next;
+            adjacency[fill[v]++] = verts_[v].prev;
+        }
+        for (const auto &[a, b] : diagonals_)
+        {
+            adjacency[fill[a]++] = b;
+            adjacency[fill[b]++] = a;
+        }
+
+        for (int v = 0; v < count; ++v)
+        {
+            if (offsets[v + 1] - offsets[v] <= 2)
+                continue;
+            const Vertex &o = verts_[v];
+            std::sort(adjacency.begin() + offsets[v], adjacency.begin() + offsets[v + 1], [&](const int a, const int b)
+            {
+                return std::atan2(verts_[a].y - o.y, verts_[a].x - o.x) < std::atan2(verts_[b].y - o.y, verts_[b].x - o.x);
+            });
+        }
+
+        auto slotOf = [&](const int v, const int neighbour)
+        {
+            int slot = offsets[v];
+            while (adjacency[slot] != neighbour)
+                ++slot;
+            return slot;
+        };
+
+        // Полурёбра по контуру в обратную сторону ограничивают внешнюю грань, их сразу помечаем
+        std::vector<bool> visited(static_cast<std::size_t>(total), false);
+        for (int v = 0; v < count; ++v)
+            visited[slotOf(v, verts_[v].prev)] = true;
+
+        std::vector<int> face;
+        for (int v = 0; v < count; ++v)
+        {
+            for (int slot = offsets[v]; slot < offsets[v + 1]; ++slot)
+            {
+                if (visited[slot])
+                    continue;
+
+                face.clear();
+                int cur = v;
+                int curSlot = slot;
+                while (!visited[curSlot])
+                {
+                    visited[curSlot] = true;
+                    face.push_back(cur);
+                    const int next = adjacency[curSlot];
+
+                    // Следующее ребро грани - первое по часовой стрелке от обратного
+                    const int back = slotOf(next, cur);
+                    const int nextSlot = back == offsets[next] ? offsets[next + 1] - 1 : back - 1;
+                    cur = next;
+                    curSlot = nextSlot;
+                }
+                triangulateMonotone(face);
+            }
+        }
+    }
+
+    void triangulateMonotone(const std::vector<int> &face)
+    {
+        const std::size_t n = face.size();
+        if (n < 3)
+            return;
+        if (n == 3)
+        {
+            emit(face[0], face[1], face[2]);
+            return;
+        }
+
+        std::size_t top = 0;
+        std::size_t bottom = 0;
+        for (std::size_t i = 1; i < n; ++i)
+        {
+            if (above(face[i], face[top]))
+                top = i;
+            if (above(face[bottom], face[i]))
+                bottom = i;
+        }
+
+        // Обход против часовой стрелки от верхней вершины идёт по левой цепи
+        std::vector<std::pair<int, bool>> sorted;
+        sorted.reserve(n);
+        std::size_t l = top;
+        std::size_t r = (top + n - 1) % n;
+        sorted.emplace_back(face[top], true);
+        l = (l + 1) % n;
+        while (sorted.size() < n)
+        {
+            const bool takeLeft = l != (bottom + 1) % n && (r == bottom || above(face[l], face[r]));
+            if (takeLeft && l != (bottom + 1) % n)
+            {
+                sorted.emplace_back(face[l], true);
+                l = (l + 1) % n;
+            }
+            else
+            {
+                sorted.emplace_back(face[r], false);
+                r = (r + n - 1) % n;
+            }
+        }
+
+        std::vector<std::pair<int, bool>> stack;
+        stack.reserve(n);
+        stack.push_back(sorted[0]);
+        stack.push_back(sorted[1]);
+
+        for (std::size_t j = 2; j + 1 < n; ++j)
+        {
+            const auto u = sorted[j];
+            if (u.second != stack.back().second)
+            {
+                while (stack.size() > 1)
+                {
+                    const auto top2 = stack.back();
+                    stack.pop_back();
+                    emit(u.first, top2.first, stack.back().first);
+                }
+                stack.clear();
+                stack.push_back(sorted[j - 1]);
+                stack.push_back(u);
+            }
+            else
+            {
+                auto last = stack.back();
+                stack.pop_back();
+                while (!stack.empty())
+                {
+                    const auto &t = stack.back();
+                    const double c = cross(verts_[t.first], verts_[u.first], verts_[last.first]);
+                    if (u.second ? c >= 0.0 : c <= 0.0)
+                        break;
+                    emit(u.first, last.first, t.first);
+                    last = stack.back();
+                    stack.pop_back();
+                }
+                stack.push_back(last);
+                stack.push_back(u);
+            }
+        }
+
+        const int lastVertex = sorted[n - 1].first;
+        while (stack.size() > 1)
+        {
+            const auto top2 = stack.back();
+            stack.pop_back();
+            emit(lastVertex, top2.first, stack.back().first);
+        }
+    }
+
+    void emit(const int a, const int b, const int c)
+    {
+        triangles_.push_back(verts_[a].index);
+        triangles_.push_back(verts_[b].index);
+        triangles_.push_back(verts_[c].index);
+    }
+};
+
+} // namespace
+
+namespace sdl3
+{
+
+std::vector<int> triangulatePolygon(std::span<const Vector2f> outer, std::span<const std::vector<Vector2f>> holes)
+{
+    std::vector<int> triangles;
+    if (outer.size() < 3)
+        return triangles;
+
+    std::size_t total = outer.size();
+    for (const auto &hole : holes)
+        total += hole.size();
+    triangles.reserve((total + 2 * holes.size()) * 3);
+
+    if (total > hashingThreshold)
+    {
+        MonotoneTriangulator monotone(triangles);
+        if (monotone.run(outer, holes))
+            return triangles;
+        // Вырожденный вход (касания, самопересечения) - откатываемся на отсечение ушей
+        triangles.clear();
+    }
+
+    EarClipper clipper(triangles);
+    clipper.run(outer, holes);
+    return triangles;
+}
+
+bool isConvexPolygon(std::span<const Vector2f> polygon)
+{
+    const std::size_t count = polygon.size();
+    if (count < 3)
+        return false;
+
+    float turnSign = 0.f;
+    int xSignChanges = 0;
+    float prevDx = polygon[0].x - polygon[count - 1].x;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const Vector2f &p0 = polygon[(i + count - 1) % count];
+        const Vector2f &p1 = polygon[i];
+        const Vector2f &p2 = polygon[(i + 1) % count];
+
+        const float cross = (p1.x - p0.x) * (p2.y - p1.y) - (p1.y - p0.y) * (p2.x - p1.x);
+        if (cross != 0.f)
+        {
+            if (turnSign == 0.f)
+                turnSign = cross;
+            else if ((cross > 0.f) != (turnSign > 0.f))
+                return false;
+        }
+
+        // Самопересекающиеся "звёзды" поворачивают в одну сторону, но обходят центр больше одного раза
+        const float dx = p2.x - p1.x;
+        if (dx != 0.f)
+        {
+            if (prevDx != 0.f && (dx > 0.f) != (prevDx > 0.f))
+                ++xSignChanges;
+            prevDx = dx;
+        }
+    }
+
+    return turnSign != 0.f && xSignChanges <= 2;
+}
+
+} // namespace sdl3
@@ -3,6 +3,7 @@
 
 #include <SDL3/SDL_init.h>
 #include <SDL3/SDL_log.h>
+#include <SDL3/SDL_render.h>
 
 namespace sdl3
 {
@@ -70,4 +71,11 @@ SDL_WindowFlags VideoMode::makeWindowFlags(const VideoMode &settings)
     return flags;
 }
 
+int VideoMode::makeVSyncInterval(const VideoMode &settings)
+{
+    if (!settings.vsync)
+        return SDL_RENDERER_VSYNC_DISABLED;
+    return settings.adaptiveVsync ? SDL_RENDERER_VSYNC_ADAPTIVE : 1;
+}
+
 } // namespace sdl3